@@ -1,33 +1,57 @@
 #include "animationsystem.h"
+#include "posepool.h"
+#include "mempolicy.h"
 #include <string.h>
 #include <malloc.h>
+#include <math.h>
+#include <stdio.h>
+
+#define ANIM_NO_PARENT 0xFFFF
 
 void animation_system_init(AnimationSystem* anim_sys, T3DModel* model, T3DSkeleton* skeleton) {
     if (!anim_sys || !model || !skeleton) return;
     
+    // Both are touched many times per frame and belong in cached memory
+    MEM_CHECK_CACHED(anim_sys, "AnimationSystem");
+    MEM_CHECK_CACHED(skeleton, "T3DSkeleton");
+    
     // Initialize system
     memset(anim_sys, 0, sizeof(AnimationSystem));
     anim_sys->model = model;
     anim_sys->skeleton = skeleton;
-    anim_sys->blend_skeleton = NULL;  // Will be created when blending is needed
+    anim_sys->blend_skeleton = NULL;  // Will be acquired when blending is needed
+    anim_sys->unblended_pose = NULL;
+    anim_sys->current_clip = ANIM_CLIP_NONE;
+    anim_sys->blend_clip = ANIM_CLIP_NONE;
     anim_sys->is_playing = false;
     anim_sys->is_blending = false;
     anim_sys->blend_factor = 0.0f;
-    strcpy(anim_sys->current_name, "None");
-    strcpy(anim_sys->blend_name, "None");
+    anim_sys->applied_blend_factor = 0.0f;
+    anim_sys->pose_dirty = true;  // Bind pose still needs its matrices built
+    for (int i = 0; i < ANIM_MAX_LAYERS; i++) {
+        anim_sys->layers[i].clip = ANIM_CLIP_NONE;
+    }
     
     debugf("Animation system initialized\n");
     
-    // List available animations for reference
+    // Build the clip table once so switching clips later only rebinds them
     uint32_t anim_count = t3d_model_get_animation_count(model);
     if (anim_count > 0) {
         T3DChunkAnim** anim_refs = malloc(anim_count * sizeof(T3DChunkAnim*));
         t3d_model_get_animations(model, anim_refs);
         
+        if (anim_count > ANIM_MAX_CLIPS) {
+            debugf("WARNING: Model has %lu animations, only the first %d are usable\n", anim_count, ANIM_MAX_CLIPS);
+            anim_count = ANIM_MAX_CLIPS;
+        }
+        
         debugf("Available animations (%lu total):\n", anim_count);
         for (uint32_t i = 0; i < anim_count; i++) {
-            debugf("  - %s\n", anim_refs[i]->name);
+            anim_sys->clips[i] = t3d_anim_create(model, anim_refs[i]->name);
+            anim_sys->clip_names[i] = anim_refs[i]->name;
+            debugf("  [%lu] %s\n", i, anim_refs[i]->name);
         }
+        anim_sys->clip_count = (int)anim_count;
         
         free(anim_refs);
     } else {
@@ -37,24 +61,227 @@ void animation_system_init(AnimationSystem* anim_sys, T3DModel* model, T3DSkelet
     anim_sys->initialized = true;
 }
 
+// Copy the local pose of every bone, equivalent to a blend with factor 1
+static void animation_system_copy_pose(T3DSkeleton* dst, const T3DSkeleton* src) {
+    int bone_count = dst->skeletonRef->boneCount;
+    for (int i = 0; i < bone_count; i++) {
+        dst->bones[i].rotation = src->bones[i].rotation;
+        dst->bones[i].position = src->bones[i].position;
+        dst->bones[i].scale = src->bones[i].scale;
+        dst->bones[i].hasChanged = true;
+    }
+}
+
+// Hamilton product a * b
+static T3DQuat animation_quat_mul(const T3DQuat* a, const T3DQuat* b) {
+    T3DQuat r = {{
+        a->v[3] * b->v[0] + a->v[0] * b->v[3] + a->v[1] * b->v[2] - a->v[2] * b->v[1],
+        a->v[3] * b->v[1] - a->v[0] * b->v[2] + a->v[1] * b->v[3] + a->v[2] * b->v[0],
+        a->v[3] * b->v[2] + a->v[0] * b->v[1] - a->v[1] * b->v[0] + a->v[2] * b->v[3],
+        a->v[3] * b->v[3] - a->v[0] * b->v[0] - a->v[1] * b->v[1] - a->v[2] * b->v[2]
+    }};
+    return r;
+}
+
+// Copy the local transforms of masked bones
+static void animation_system_copy_masked(T3DSkeleton* dst, const T3DSkeleton* src, uint32_t mask) {
+    int bone_count = dst->skeletonRef->boneCount;
+    for (int i = 0; i < bone_count && mask; i++) {
+        if (!(mask & (1u << i))) continue;
+        dst->bones[i].rotation = src->bones[i].rotation;
+        dst->bones[i].position = src->bones[i].position;
+        dst->bones[i].scale = src->bones[i].scale;
+        dst->bones[i].hasChanged = true;
+    }
+}
+
+// Combine one layer into a bone that already holds the pose beneath it
+static void animation_layer_apply_bone(const AnimLayer* layer, const T3DChunkBone* ref, T3DBone* out, int bone) {
+    const T3DBone* src = &layer->pose->bones[bone];
+    float w = layer->weight;
+    
+    if (layer->mode == ANIM_LAYER_OVERRIDE) {
+        t3d_quat_nlerp(&out->rotation, &out->rotation, &src->rotation, w);
+        t3d_vec3_lerp(&out->position, &out->position, &src->position, w);
+        t3d_vec3_lerp(&out->scale, &out->scale, &src->scale, w);
+        return;
+    }
+    
+    // Additive: offset of the layer pose from the bind pose, scaled by weight
+    T3DQuat ref_inv = {{-ref->rotation.v[0], -ref->rotation.v[1], -ref->rotation.v[2], ref->rotation.v[3]}};
+    T3DQuat delta = animation_quat_mul(&ref_inv, &src->rotation);
+    T3DQuat identity = {{0.0f, 0.0f, 0.0f, 1.0f}};
+    t3d_quat_nlerp(&delta, &identity, &delta, w);
+    out->rotation = animation_quat_mul(&out->rotation, &delta);
+    for (int i = 0; i < 3; i++) {
+        out->position.v[i] += (src->position.v[i] - ref->position.v[i]) * w;
+    }
+}
+
+// Advance layer clips and rebuild masked bones when the base or a layer changed
+static void animation_system_apply_layers(AnimationSystem* anim_sys, float delta_time, bool base_written) {
+    if (!anim_sys->layer_mask || !anim_sys->base_pose) return;
+    
+    bool layers_changed = false;
+    for (int l = 0; l < ANIM_MAX_LAYERS; l++) {
+        AnimLayer* layer = &anim_sys->layers[l];
+        if (!layer->active) continue;
+        
+        T3DAnim* anim = &anim_sys->clips[layer->clip];
+        if (anim->isPlaying) {
+            t3d_anim_update(anim, delta_time);
+            layers_changed = true;
+        }
+        if (layer->weight != layer->applied_weight) layers_changed = true;
+    }
+    
+    // The base just produced a fresh pose; remember it for masked bones
+    if (base_written) {
+        animation_system_copy_masked(anim_sys->base_pose, anim_sys->skeleton, anim_sys->layer_mask);
+        layers_changed = true;
+    }
+    if (!layers_changed) return;
+    
+    // Only masked bones are touched
+    const T3DChunkSkeleton* ref = anim_sys->skeleton->skeletonRef;
+    int bone_count = ref->boneCount;
+    for (int b = 0; b < bone_count; b++) {
+        uint32_t bit = 1u << b;
+        if (!(anim_sys->layer_mask & bit)) continue;
+        
+        T3DBone* out = &anim_sys->skeleton->bones[b];
+        const T3DBone* base = &anim_sys->base_pose->bones[b];
+        out->rotation = base->rotation;
+        out->position = base->position;
+        out->scale = base->scale;
+        
+        for (int l = 0; l < ANIM_MAX_LAYERS; l++) {
+            const AnimLayer* layer = &anim_sys->layers[l];
+            if (layer->active && (layer->bone_mask & bit) && layer->weight > 0.0f) {
+                animation_layer_apply_bone(layer, &ref->bones[b], out, b);
+            }
+        }
+        out->hasChanged = true;
+    }
+    
+    for (int l = 0; l < ANIM_MAX_LAYERS; l++) {
+        anim_sys->layers[l].applied_weight = anim_sys->layers[l].weight;
+    }
+    anim_sys->pose_dirty = true;
+}
+
+// Write one baked frame into the skeleton; returns false if the frame did not change
+static bool animation_system_update_baked(AnimationSystem* anim_sys, float delta_time) {
+    const BakedPoseSet* set = anim_sys->baked_set;
+    const BakedClipHeader* clip = &set->clips[anim_sys->baked_clip];
+    float length = (float)clip->frame_count / (float)clip->rate;
+    
+    anim_sys->baked_time += delta_time;
+    if (anim_sys->baked_time >= length) {
+        if (anim_sys->baked_loop) {
+            anim_sys->baked_time = fmodf(anim_sys->baked_time, length);
+        } else {
+            anim_sys->baked_time = length;
+            anim_sys->baked_playing = false;
+        }
+    }
+    
+    int frame = (int)(anim_sys->baked_time * clip->rate);
+    if (frame >= clip->frame_count) frame = clip->frame_count - 1;
+    if (frame == anim_sys->baked_frame) return false;
+    anim_sys->baked_frame = frame;
+    
+    bool has_scale = (clip->flags & BAKED_CLIP_HAS_SCALE) != 0;
+    int stride = has_scale ? 9 : 6;
+    const int16_t* src = (const int16_t*)(set->data + clip->data_offset) + frame * set->bone_count * stride;
+    
+    for (int i = 0; i < set->bone_count; i++, src += stride) {
+        int bone = set->bone_map[i];
+        if (bone < 0) continue;
+        
+        T3DBone* out = &anim_sys->skeleton->bones[bone];
+        float x = src[0] * (1.0f / 32767.0f);
+        float y = src[1] * (1.0f / 32767.0f);
+        float z = src[2] * (1.0f / 32767.0f);
+        float ww = 1.0f - (x * x + y * y + z * z);
+        out->rotation = (T3DQuat){{x, y, z, ww > 0.0f ? sqrtf(ww) : 0.0f}};
+        out->position = (T3DVec3){{src[3] * clip->pos_scale, src[4] * clip->pos_scale, src[5] * clip->pos_scale}};
+        if (has_scale) {
+            out->scale = (T3DVec3){{src[6] * (1.0f / 4096.0f), src[7] * (1.0f / 4096.0f), src[8] * (1.0f / 4096.0f)}};
+        }
+        out->hasChanged = true;
+    }
+    return true;
+}
+
 void animation_system_update(AnimationSystem* anim_sys, float delta_time) {
     if (!anim_sys || !anim_sys->initialized) return;
     
-    // Update current animation if playing
+    // Set when the base clips wrote new bone values this update
+    bool base_written = false;
+    
+    // Baked tables only write bones when the frame index moves
+    if (anim_sys->baked_playing) {
+        base_written = animation_system_update_baked(anim_sys, delta_time);
+    }
+    
+    // Update current animation if playing (a paused or finished clip leaves the pose alone)
     if (anim_sys->is_playing) {
-        t3d_anim_update(&anim_sys->current_anim, delta_time);
+        T3DAnim* anim = &anim_sys->clips[anim_sys->current_clip];
+        if (anim->isPlaying) {
+            t3d_anim_update(anim, delta_time);
+            base_written = true;
+        }
     }
     
     // Update blend animation if blending
-    if (anim_sys->is_blending && anim_sys->blend_skeleton) {
-        t3d_anim_update(&anim_sys->blend_anim, delta_time);
+    if (anim_sys->is_blending && anim_sys->blend_skeleton && anim_sys->unblended_pose) {
+        T3DAnim* anim = &anim_sys->clips[anim_sys->blend_clip];
+        bool blend_changed = (anim_sys->blend_factor != anim_sys->applied_blend_factor);
+        if (anim->isPlaying) {
+            t3d_anim_update(anim, delta_time);
+            blend_changed = true;
+        }
         
-        // Perform the blend
-        t3d_skeleton_blend(anim_sys->skeleton, anim_sys->skeleton, anim_sys->blend_skeleton, anim_sys->blend_factor);
+        // The main skeleton holds the last blended result unless the base just wrote it,
+        // so keep the fresh base and always blend from that copy (reblending the result would drift)
+        if (base_written) {
+            animation_system_copy_pose(anim_sys->unblended_pose, anim_sys->skeleton);
+        }
+        
+        // Perform the blend; at 1 it is a straight copy, at 0 the base pose is the result
+        if (base_written || blend_changed) {
+            if (anim_sys->blend_factor >= 1.0f) {
+                animation_system_copy_pose(anim_sys->skeleton, anim_sys->blend_skeleton);
+            } else if (anim_sys->blend_factor > 0.0f) {
+                t3d_skeleton_blend(anim_sys->skeleton, anim_sys->unblended_pose, anim_sys->blend_skeleton, anim_sys->blend_factor);
+            } else if (!base_written) {
+                animation_system_copy_pose(anim_sys->skeleton, anim_sys->unblended_pose);
+            }
+            anim_sys->applied_blend_factor = anim_sys->blend_factor;
+            base_written = true;
+        }
     }
+    if (base_written) anim_sys->pose_dirty = true;
     
-    // Always update skeleton
+    // Layers go over the finished base pose
+    animation_system_apply_layers(anim_sys, delta_time, base_written);
+}
+
+void animation_system_build_matrices(AnimationSystem* anim_sys) {
+    if (!anim_sys || !anim_sys->initialized || !anim_sys->pose_dirty) return;
+    
+    // Buffered skeletons write a matrix set no in-flight frame is reading; that only holds
+    // with one rotation per rendered frame, so several simulation ticks share one rebuild
+    t3d_skeleton_use_next_buffer(anim_sys->skeleton);
     t3d_skeleton_update(anim_sys->skeleton);
+    anim_sys->pose_dirty = false;
+}
+
+T3DMat4FP* animation_system_get_bone_matrices(const T3DSkeleton* skeleton) {
+    if (!skeleton || !skeleton->boneMatricesFP) return NULL;
+    if (skeleton->bufferCount <= 1) return skeleton->boneMatricesFP;
+    return skeleton->boneMatricesFP + skeleton->currentBufferIdx * skeleton->skeletonRef->boneCount;
 }
 
 void animation_system_cleanup(AnimationSystem* anim_sys) {
@@ -63,54 +290,102 @@ void animation_system_cleanup(AnimationSystem* anim_sys) {
     // Stop current animation
     animation_system_stop(anim_sys);
     
-    // Free blend skeleton if allocated
+    // Return layer and blend poses to the pool
+    for (int i = 0; i < ANIM_MAX_LAYERS; i++) {
+        animation_system_stop_layer(anim_sys, i);
+    }
     if (anim_sys->blend_skeleton) {
-        t3d_skeleton_destroy(anim_sys->blend_skeleton);
-        free_uncached(anim_sys->blend_skeleton);
+        pose_pool_release(anim_sys->blend_skeleton);
         anim_sys->blend_skeleton = NULL;
     }
+    if (anim_sys->unblended_pose) {
+        pose_pool_release(anim_sys->unblended_pose);
+        anim_sys->unblended_pose = NULL;
+    }
+    
+    // Free the clip table
+    for (int i = 0; i < anim_sys->clip_count; i++) {
+        t3d_anim_destroy(&anim_sys->clips[i]);
+    }
     
     memset(anim_sys, 0, sizeof(AnimationSystem));
 }
 
-bool animation_system_play(AnimationSystem* anim_sys, const char* anim_name, bool loop) {
-    if (!anim_sys || !anim_name || !anim_sys->initialized) return false;
+int animation_system_find_clip(AnimationSystem* anim_sys, const char* anim_name) {
+    if (!anim_sys || !anim_name) return ANIM_CLIP_NONE;
+    
+    for (int i = 0; i < anim_sys->clip_count; i++) {
+        if (strcmp(anim_sys->clip_names[i], anim_name) == 0) {
+            return i;
+        }
+    }
+    return ANIM_CLIP_NONE;
+}
+
+// Attach a prebuilt clip to a skeleton and restart it
+static void animation_system_bind_clip(AnimationSystem* anim_sys, int clip, T3DSkeleton* target, bool loop) {
+    T3DAnim* anim = &anim_sys->clips[clip];
+    t3d_anim_attach(anim, target);
+    t3d_anim_set_looping(anim, loop);
+    t3d_anim_set_time(anim, 0.0f);
+    t3d_anim_set_playing(anim, true);
+    anim_sys->pose_dirty = true;
+}
+
+bool animation_system_play_clip(AnimationSystem* anim_sys, int clip, bool loop) {
+    if (!anim_sys || !anim_sys->initialized) return false;
     
     // Stop current animation first
     animation_system_stop(anim_sys);
     
-    // Try to create and start new animation
-    anim_sys->current_anim = t3d_anim_create(anim_sys->model, anim_name);
-    
-    // Check if animation was created successfully
-    if (anim_sys->current_anim.animRef == NULL) {
-        debugf("Animation '%s' not found\n", anim_name);
-        strcpy(anim_sys->current_name, "None");
+    if (clip < 0 || clip >= anim_sys->clip_count) {
+        debugf("Animation clip %d not found\n", clip);
         return false;
     }
     
-    // Attach and start animation
-    t3d_anim_attach(&anim_sys->current_anim, anim_sys->skeleton);
-    t3d_anim_set_looping(&anim_sys->current_anim, loop);
-    t3d_anim_set_playing(&anim_sys->current_anim, true);
+    // A clip can only drive one skeleton at a time
+    if (anim_sys->is_blending && anim_sys->blend_clip == clip) {
+        t3d_anim_set_playing(&anim_sys->clips[clip], false);
+        anim_sys->blend_clip = ANIM_CLIP_NONE;
+        anim_sys->is_blending = false;
+    }
+    
+    // Rebind and start animation
+    animation_system_bind_clip(anim_sys, clip, anim_sys->skeleton, loop);
     
     // Update state
+    anim_sys->current_clip = clip;
     anim_sys->is_playing = true;
-    strncpy(anim_sys->current_name, anim_name, sizeof(anim_sys->current_name) - 1);
-    anim_sys->current_name[sizeof(anim_sys->current_name) - 1] = '\0';
     
-    debugf("Playing animation: %s (loop: %s)\n", anim_name, loop ? "yes" : "no");
+    debugf("Playing animation: %s (loop: %s)\n", anim_sys->clip_names[clip], loop ? "yes" : "no");
     return true;
 }
 
+bool animation_system_play(AnimationSystem* anim_sys, const char* anim_name, bool loop) {
+    if (!anim_sys || !anim_name || !anim_sys->initialized) return false;
+    
+    int clip = animation_system_find_clip(anim_sys, anim_name);
+    if (clip == ANIM_CLIP_NONE) {
+        debugf("Animation '%s' not found\n", anim_name);
+        animation_system_stop(anim_sys);
+        return false;
+    }
+    
+    return animation_system_play_clip(anim_sys, clip, loop);
+}
+
 void animation_system_stop(AnimationSystem* anim_sys) {
-    if (!anim_sys || !anim_sys->is_playing) return;
+    if (!anim_sys) return;
     
-    t3d_anim_set_playing(&anim_sys->current_anim, false);
-    t3d_anim_destroy(&anim_sys->current_anim);
+    anim_sys->baked_playing = false;
+    anim_sys->baked_set = NULL;
+    if (!anim_sys->is_playing) return;
+    
+    // Clips stay in the table, they are just detached from playback
+    t3d_anim_set_playing(&anim_sys->clips[anim_sys->current_clip], false);
     
     anim_sys->is_playing = false;
-    strcpy(anim_sys->current_name, "None");
+    anim_sys->current_clip = ANIM_CLIP_NONE;
     
     debugf("Animation stopped\n");
 }
@@ -118,78 +393,97 @@ void animation_system_stop(AnimationSystem* anim_sys) {
 void animation_system_pause(AnimationSystem* anim_sys) {
     if (!anim_sys || !anim_sys->is_playing) return;
     
-    t3d_anim_set_playing(&anim_sys->current_anim, false);
+    t3d_anim_set_playing(&anim_sys->clips[anim_sys->current_clip], false);
     debugf("Animation paused\n");
 }
 
 void animation_system_resume(AnimationSystem* anim_sys) {
     if (!anim_sys || !anim_sys->is_playing) return;
     
-    t3d_anim_set_playing(&anim_sys->current_anim, true);
+    t3d_anim_set_playing(&anim_sys->clips[anim_sys->current_clip], true);
     debugf("Animation resumed\n");
 }
 
 const char* animation_system_get_current_name(AnimationSystem* anim_sys) {
-    return anim_sys ? anim_sys->current_name : "None";
+    if (!anim_sys || anim_sys->current_clip == ANIM_CLIP_NONE) return "None";
+    return anim_sys->clip_names[anim_sys->current_clip];
 }
 
 bool animation_system_is_playing(AnimationSystem* anim_sys) {
-    return anim_sys ? anim_sys->is_playing : false;
+    return anim_sys ? (anim_sys->is_playing || anim_sys->baked_playing) : false;
 }
 
-bool animation_system_blend_to(AnimationSystem* anim_sys, const char* target_anim_name, float blend_speed, bool loop) {
-    if (!anim_sys || !target_anim_name || !anim_sys->initialized) return false;
+bool animation_system_blend_to_clip(AnimationSystem* anim_sys, int target_clip, float blend_speed, bool loop) {
+    if (!anim_sys || !anim_sys->initialized) return false;
     
     // If not currently playing anything, just play the target animation
     if (!anim_sys->is_playing) {
-        return animation_system_play(anim_sys, target_anim_name, loop);
+        return animation_system_play_clip(anim_sys, target_clip, loop);
+    }
+    
+    if (target_clip < 0 || target_clip >= anim_sys->clip_count) {
+        debugf("Blend animation clip %d not found\n", target_clip);
+        return false;
     }
     
     // If we're already blending to this animation, nothing to do
-    if (anim_sys->is_blending && strcmp(anim_sys->blend_name, target_anim_name) == 0) {
+    if (anim_sys->is_blending && anim_sys->blend_clip == target_clip) {
         return true;
     }
     
     // If current animation is already the target, nothing to do
-    if (strcmp(anim_sys->current_name, target_anim_name) == 0) {
+    if (anim_sys->current_clip == target_clip) {
         return true;
     }
     
-    // Create blend skeleton if it doesn't exist
+    // Borrow a blend pose if we don't have one (no bone matrices are needed)
     if (!anim_sys->blend_skeleton) {
-        anim_sys->blend_skeleton = malloc_uncached(sizeof(T3DSkeleton));
-        *anim_sys->blend_skeleton = t3d_skeleton_clone(anim_sys->skeleton, false);
-        debugf("Created blend skeleton\n");
+        anim_sys->blend_skeleton = pose_pool_acquire(anim_sys->skeleton);
+        if (!anim_sys->blend_skeleton) {
+            debugf("No blend pose available\n");
+            return false;
+        }
+        debugf("Acquired blend pose\n");
     }
     
-    // If we were already blending, clean up the old blend animation
-    if (anim_sys->is_blending) {
-        t3d_anim_destroy(&anim_sys->blend_anim);
+    // Starts as the current main pose, which is unblended until the first blend runs
+    if (!anim_sys->unblended_pose) {
+        anim_sys->unblended_pose = pose_pool_acquire(anim_sys->skeleton);
+        if (!anim_sys->unblended_pose) {
+            debugf("No unblended pose available\n");
+            return false;
+        }
     }
     
-    // Create and start the blend animation
-    anim_sys->blend_anim = t3d_anim_create(anim_sys->model, target_anim_name);
-    
-    if (anim_sys->blend_anim.animRef == NULL) {
-        debugf("Blend animation '%s' not found\\n", target_anim_name);
-        anim_sys->is_blending = false;
-        return false;
+    // If we were already blending, stop the old blend clip
+    if (anim_sys->is_blending) {
+        t3d_anim_set_playing(&anim_sys->clips[anim_sys->blend_clip], false);
     }
     
-    // Attach and start blend animation
-    t3d_anim_attach(&anim_sys->blend_anim, anim_sys->blend_skeleton);
-    t3d_anim_set_looping(&anim_sys->blend_anim, loop);
-    t3d_anim_set_playing(&anim_sys->blend_anim, true);
+    // Rebind and start the blend animation
+    animation_system_bind_clip(anim_sys, target_clip, anim_sys->blend_skeleton, loop);
     
     // Update state
+    anim_sys->blend_clip = target_clip;
     anim_sys->is_blending = true;
-    strncpy(anim_sys->blend_name, target_anim_name, sizeof(anim_sys->blend_name) - 1);
-    anim_sys->blend_name[sizeof(anim_sys->blend_name) - 1] = '\0';
     
-    debugf("Blending from '%s' to '%s'\n", anim_sys->current_name, target_anim_name);
+    debugf("Blending from '%s' to '%s'\n", animation_system_get_current_name(anim_sys),
+           anim_sys->clip_names[target_clip]);
     return true;
 }
 
+bool animation_system_blend_to(AnimationSystem* anim_sys, const char* target_anim_name, float blend_speed, bool loop) {
+    if (!anim_sys || !target_anim_name || !anim_sys->initialized) return false;
+    
+    int clip = animation_system_find_clip(anim_sys, target_anim_name);
+    if (clip == ANIM_CLIP_NONE) {
+        debugf("Blend animation '%s' not found\n", target_anim_name);
+        return false;
+    }
+    
+    return animation_system_blend_to_clip(anim_sys, clip, blend_speed, loop);
+}
+
 void animation_system_set_blend_factor(AnimationSystem* anim_sys, float factor) {
     if (!anim_sys) return;
     
@@ -208,41 +502,377 @@ bool animation_system_is_blending(AnimationSystem* anim_sys) {
     return anim_sys ? anim_sys->is_blending : false;
 }
 
-void animation_system_update_position_blend(AnimationSystem* anim_sys, float normalized_position,
-                                            const char* left_anim, const char* right_anim, bool loop) {
+void animation_system_update_position_blend_clip(AnimationSystem* anim_sys, float normalized_position,
+                                                 int left_clip, int right_clip, bool loop) {
     if (!anim_sys || !anim_sys->initialized) return;
     
     // Clamp normalized_position to [0, 1]
     if (normalized_position < 0.0f) normalized_position = 0.0f;
     if (normalized_position > 1.0f) normalized_position = 1.0f;
     
-    // Check if animation names have changed (e.g., switching from Combat to Slash animations)
+    // Check if the clip pair has changed (e.g., switching from Combat to Slash animations)
     bool animations_changed = false;
     if (anim_sys->is_blending) {
-        animations_changed = (strcmp(anim_sys->current_name, left_anim) != 0 ||
-                             strcmp(anim_sys->blend_name, right_anim) != 0);
+        animations_changed = (anim_sys->current_clip != left_clip ||
+                             anim_sys->blend_clip != right_clip);
     }
     
-    // If animations changed, stop and clean up current blend
+    // If animations changed, stop the current pair so both can be rebound
     if (animations_changed) {
-        t3d_anim_set_playing(&anim_sys->current_anim, false);
-        t3d_anim_destroy(&anim_sys->current_anim);
-        if (anim_sys->is_blending) {
-            t3d_anim_set_playing(&anim_sys->blend_anim, false);
-            t3d_anim_destroy(&anim_sys->blend_anim);
-        }
-        anim_sys->is_playing = false;
+        animation_system_stop(anim_sys);
+        t3d_anim_set_playing(&anim_sys->clips[anim_sys->blend_clip], false);
+        anim_sys->blend_clip = ANIM_CLIP_NONE;
         anim_sys->is_blending = false;
     }
     
     // Check if we need to set up or restart the blending
     if (!anim_sys->is_blending) {
         // Start blending between left and right animations
-        animation_system_play(anim_sys, left_anim, loop);
-        animation_system_blend_to(anim_sys, right_anim, 0.0f, loop);
+        animation_system_play_clip(anim_sys, left_clip, loop);
+        animation_system_blend_to_clip(anim_sys, right_clip, 0.0f, loop);
     }
     
     // Apply blend factor based on normalized position
     // 0.0 = full left animation, 1.0 = full right animation
     animation_system_set_blend_factor(anim_sys, normalized_position);
 }
+
+void animation_system_update_position_blend(AnimationSystem* anim_sys, float normalized_position,
+                                            const char* left_anim, const char* right_anim, bool loop) {
+    if (!anim_sys || !anim_sys->initialized) return;
+    
+    animation_system_update_position_blend_clip(anim_sys, normalized_position,
+                                                animation_system_find_clip(anim_sys, left_anim),
+                                                animation_system_find_clip(anim_sys, right_anim), loop);
+}
+
+uint32_t animation_system_get_bone_mask(AnimationSystem* anim_sys, const char* root_bone) {
+    if (!anim_sys || !anim_sys->initialized || !root_bone) return 0;
+    
+    const T3DChunkSkeleton* ref = anim_sys->skeleton->skeletonRef;
+    int bone_count = ref->boneCount;
+    if (bone_count > 32) bone_count = 32;
+    
+    int root = -1;
+    for (int i = 0; i < bone_count; i++) {
+        if (strcmp(ref->bones[i].name, root_bone) == 0) {
+            root = i;
+            break;
+        }
+    }
+    if (root < 0) {
+        debugf("Bone '%s' not found\n", root_bone);
+        return 0;
+    }
+    
+    // The root bone and everything below it
+    uint32_t mask = 0;
+    for (int i = 0; i < bone_count; i++) {
+        int idx = i;
+        while (idx != root && idx < bone_count && ref->bones[idx].parentIdx != ANIM_NO_PARENT) {
+            idx = ref->bones[idx].parentIdx;
+        }
+        if (idx == root) mask |= (1u << i);
+    }
+    return mask;
+}
+
+static void animation_system_update_layer_mask(AnimationSystem* anim_sys) {
+    anim_sys->layer_mask = 0;
+    for (int i = 0; i < ANIM_MAX_LAYERS; i++) {
+        if (anim_sys->layers[i].active) {
+            anim_sys->layer_mask |= anim_sys->layers[i].bone_mask;
+        }
+    }
+}
+
+bool animation_system_play_layer(AnimationSystem* anim_sys, int layer, int clip, AnimLayerMode mode,
+                                 uint32_t bone_mask, float weight, bool loop) {
+    if (!anim_sys || !anim_sys->initialized) return false;
+    if (layer < 0 || layer >= ANIM_MAX_LAYERS) return false;
+    if (clip < 0 || clip >= anim_sys->clip_count || !bone_mask) return false;
+    
+    // A clip can only drive one pose at a time
+    if (clip == anim_sys->current_clip || (anim_sys->is_blending && clip == anim_sys->blend_clip)) {
+        debugf("Layer clip '%s' is already playing on the base\n", anim_sys->clip_names[clip]);
+        return false;
+    }
+    for (int i = 0; i < ANIM_MAX_LAYERS; i++) {
+        if (i != layer && anim_sys->layers[i].active && anim_sys->layers[i].clip == clip) {
+            debugf("Layer clip '%s' is already playing on layer %d\n", anim_sys->clip_names[clip], i);
+            return false;
+        }
+    }
+    
+    animation_system_stop_layer(anim_sys, layer);
+    AnimLayer* l = &anim_sys->layers[layer];
+    
+    // Masked bones still hold the plain base pose; keep a copy to layer over
+    if (!anim_sys->base_pose) {
+        anim_sys->base_pose = pose_pool_acquire(anim_sys->skeleton);
+    } else {
+        animation_system_copy_masked(anim_sys->base_pose, anim_sys->skeleton, bone_mask & ~anim_sys->layer_mask);
+    }
+    l->pose = pose_pool_acquire(anim_sys->skeleton);
+    if (!anim_sys->base_pose || !l->pose) {
+        pose_pool_release(l->pose);
+        l->pose = NULL;
+        if (!anim_sys->layer_mask) {
+            pose_pool_release(anim_sys->base_pose);
+            anim_sys->base_pose = NULL;
+        }
+        return false;
+    }
+    
+    T3DAnim* anim = &anim_sys->clips[clip];
+    t3d_anim_attach(anim, l->pose);
+    t3d_anim_set_looping(anim, loop);
+    t3d_anim_set_time(anim, 0.0f);
+    t3d_anim_set_playing(anim, true);
+    
+    l->clip = clip;
+    l->mode = mode;
+    l->bone_mask = bone_mask;
+    l->weight = weight;
+    l->applied_weight = -1.0f;
+    l->active = true;
+    animation_system_update_layer_mask(anim_sys);
+    
+    debugf("Layer %d playing: %s\n", layer, anim_sys->clip_names[clip]);
+    return true;
+}
+
+void animation_system_set_layer_weight(AnimationSystem* anim_sys, int layer, float weight) {
+    if (!anim_sys || layer < 0 || layer >= ANIM_MAX_LAYERS) return;
+    
+    if (weight < 0.0f) weight = 0.0f;
+    if (weight > 1.0f) weight = 1.0f;
+    anim_sys->layers[layer].weight = weight;
+}
+
+void animation_system_stop_layer(AnimationSystem* anim_sys, int layer) {
+    if (!anim_sys || layer < 0 || layer >= ANIM_MAX_LAYERS) return;
+    
+    AnimLayer* l = &anim_sys->layers[layer];
+    if (!l->active) return;
+    
+    // Put the base pose back and let the remaining layers reapply
+    t3d_anim_set_playing(&anim_sys->clips[l->clip], false);
+    animation_system_copy_masked(anim_sys->skeleton, anim_sys->base_pose, l->bone_mask);
+    pose_pool_release(l->pose);
+    l->pose = NULL;
+    l->active = false;
+    l->clip = ANIM_CLIP_NONE;
+    
+    animation_system_update_layer_mask(anim_sys);
+    for (int i = 0; i < ANIM_MAX_LAYERS; i++) {
+        anim_sys->layers[i].applied_weight = -1.0f;
+    }
+    if (!anim_sys->layer_mask) {
+        pose_pool_release(anim_sys->base_pose);
+        anim_sys->base_pose = NULL;
+    }
+    anim_sys->pose_dirty = true;
+}
+
+BakedPoseSet* baked_pose_set_load(const char* path, const T3DSkeleton* skeleton) {
+    if (!path || !skeleton || !skeleton->skeletonRef) return NULL;
+    
+    int size = 0;
+    uint8_t* data = asset_load(path, &size);
+    if (!data) {
+        debugf("WARNING: Failed to load pose table %s\n", path);
+        return NULL;
+    }
+    
+    // Header: magic, version, bone count, clip count, reserved
+    const uint16_t* header = (const uint16_t*)(data + 4);
+    int bone_count = header[1];
+    int clip_count = header[2];
+    if (memcmp(data, "POSE", 4) != 0 || header[0] != 1 || bone_count > BAKED_POSE_MAX_BONES) {
+        debugf("WARNING: %s is not a supported pose table\n", path);
+        free(data);
+        return NULL;
+    }
+    
+    BakedPoseSet* set = malloc(sizeof(BakedPoseSet));
+    set->data = data;
+    set->bone_count = bone_count;
+    set->clip_count = clip_count;
+    set->clips = (const BakedClipHeader*)(data + 12 + BAKED_POSE_NAME_LEN * bone_count);
+    
+    // Match file bones to skeleton bones by name
+    const T3DChunkSkeleton* ref = skeleton->skeletonRef;
+    const char* names = (const char*)(data + 12);
+    for (int i = 0; i < bone_count; i++) {
+        set->bone_map[i] = -1;
+        for (int b = 0; b < ref->boneCount; b++) {
+            if (strncmp(ref->bones[b].name, names + i * BAKED_POSE_NAME_LEN, BAKED_POSE_NAME_LEN) == 0) {
+                set->bone_map[i] = b;
+                break;
+            }
+        }
+    }
+    
+    debugf("Loaded pose table %s: %d clips, %d bones, %d bytes\n", path, clip_count, bone_count, size);
+    return set;
+}
+
+int baked_pose_set_find_clip(const BakedPoseSet* set, const char* name) {
+    if (!set || !name) return ANIM_CLIP_NONE;
+    
+    for (int i = 0; i < set->clip_count; i++) {
+        if (strncmp(set->clips[i].name, name, BAKED_POSE_NAME_LEN) == 0) {
+            return i;
+        }
+    }
+    return ANIM_CLIP_NONE;
+}
+
+void baked_pose_set_free(BakedPoseSet* set) {
+    if (!set) return;
+    
+    free(set->data);
+    free(set);
+}
+
+bool animation_system_play_baked(AnimationSystem* anim_sys, const BakedPoseSet* set, int clip, bool loop) {
+    if (!anim_sys || !anim_sys->initialized || !set) return false;
+    if (clip < 0 || clip >= set->clip_count) return false;
+    
+    animation_system_stop(anim_sys);
+    
+    anim_sys->baked_set = set;
+    anim_sys->baked_clip = clip;
+    anim_sys->baked_frame = -1;
+    anim_sys->baked_time = 0.0f;
+    anim_sys->baked_loop = loop;
+    anim_sys->baked_playing = true;
+    
+    debugf("Playing baked animation: %.32s (loop: %s)\n", set->clips[clip].name, loop ? "yes" : "no");
+    return true;
+}
+
+#ifdef ANIM_BENCHMARK
+void animation_system_benchmark(const char* model_path, const char* clip_name, const char* pose_path) {
+    const int iterations = 240;
+    const float step = 1.0f / 60.0f;
+    
+    T3DModel* model = t3d_model_load(model_path);
+    if (!model) return;
+    
+    T3DSkeleton* skeleton = mem_alloc_cpu(sizeof(T3DSkeleton));
+    *skeleton = t3d_skeleton_create(model);
+    
+    AnimationSystem anim_sys;
+    animation_system_init(&anim_sys, model, skeleton);
+    BakedPoseSet* set = baked_pose_set_load(pose_path, skeleton);
+    int clip = animation_system_find_clip(&anim_sys, clip_name);
+    int baked = baked_pose_set_find_clip(set, clip_name);
+    
+    if (clip != ANIM_CLIP_NONE && baked != ANIM_CLIP_NONE) {
+        // Live path: keyframe decode only, then decode plus bone matrices
+        animation_system_play_clip(&anim_sys, clip, true);
+        uint64_t start = get_ticks_us();
+        for (int i = 0; i < iterations; i++) {
+            t3d_anim_update(&anim_sys.clips[clip], step);
+        }
+        uint64_t live_sample = get_ticks_us() - start;
+        start = get_ticks_us();
+        for (int i = 0; i < iterations; i++) {
+            animation_system_update(&anim_sys, step);
+            animation_system_build_matrices(&anim_sys);
+        }
+        uint64_t live_total = get_ticks_us() - start;
+        
+        // Baked path: the same two measurements
+        animation_system_play_baked(&anim_sys, set, baked, true);
+        start = get_ticks_us();
+        for (int i = 0; i < iterations; i++) {
+            animation_system_update_baked(&anim_sys, step);
+        }
+        uint64_t baked_sample = get_ticks_us() - start;
+        start = get_ticks_us();
+        for (int i = 0; i < iterations; i++) {
+            animation_system_update(&anim_sys, step);
+            animation_system_build_matrices(&anim_sys);
+        }
+        uint64_t baked_total = get_ticks_us() - start;
+        
+        // ROM cost: baked frames vs the model's streamed keyframe file (shared by all clips)
+        const BakedClipHeader* hdr = &set->clips[baked];
+        int stride = (hdr->flags & BAKED_CLIP_HAS_SCALE) ? 9 : 6;
+        int baked_bytes = hdr->frame_count * set->bone_count * stride * (int)sizeof(int16_t);
+        long stream_bytes = -1;
+        const T3DChunkAnim* anim_ref = anim_sys.clips[clip].animRef;
+        FILE* f = anim_ref->filePath ? fopen(anim_ref->filePath, "rb") : NULL;
+        if (f) {
+            fseek(f, 0, SEEK_END);
+            stream_bytes = ftell(f);
+            fclose(f);
+        }
+        
+        debugf("Animation benchmark '%s' (%d updates @ 60 Hz):\n", clip_name, iterations);
+        debugf("  live : %5.1f us/update sampling, %5.1f us/update total, %lu keyframes, stream file %ld bytes\n",
+               (float)live_sample / iterations, (float)live_total / iterations,
+               anim_ref->keyframeCount, stream_bytes);
+        debugf("  baked: %5.1f us/update sampling, %5.1f us/update total, %d frames @ %d Hz, %d bytes\n",
+               (float)baked_sample / iterations, (float)baked_total / iterations,
+               hdr->frame_count, hdr->rate, baked_bytes);
+    } else {
+        debugf("Animation benchmark: clip '%s' missing from model or pose table\n", clip_name);
+    }
+    
+    baked_pose_set_free(set);
+    animation_system_cleanup(&anim_sys);
+    t3d_skeleton_destroy(skeleton);
+    mem_free_cpu(skeleton);
+    t3d_model_free(model);
+}
+
+// Time one player-style update with the animation state in the given placement
+static uint64_t animation_system_benchmark_placement_run(T3DModel* model, const char* clip_name,
+                                                         bool uncached, int iterations) {
+    const float step = 1.0f / 60.0f;
+    T3DSkeleton* skeleton = uncached ? malloc_uncached(sizeof(T3DSkeleton)) : mem_alloc_cpu(sizeof(T3DSkeleton));
+    AnimationSystem* anim_sys = uncached ? malloc_uncached(sizeof(AnimationSystem)) : mem_alloc_cpu(sizeof(AnimationSystem));
+    *skeleton = t3d_skeleton_create(model);
+    animation_system_init(anim_sys, model, skeleton);
+    animation_system_play(anim_sys, clip_name, true);
+    
+    uint64_t start = get_ticks_us();
+    for (int i = 0; i < iterations; i++) {
+        animation_system_update(anim_sys, step);
+        animation_system_build_matrices(anim_sys);
+    }
+    uint64_t elapsed = get_ticks_us() - start;
+    
+    animation_system_cleanup(anim_sys);
+    t3d_skeleton_destroy(skeleton);
+    if (uncached) {
+        free_uncached(anim_sys);
+        free_uncached(skeleton);
+    } else {
+        mem_free_cpu(anim_sys);
+        mem_free_cpu(skeleton);
+    }
+    return elapsed;
+}
+
+void animation_system_benchmark_placement(const char* model_path, const char* clip_name) {
+    const int iterations = 240;
+    
+    T3DModel* model = t3d_model_load(model_path);
+    if (!model) return;
+    
+    uint64_t uncached_us = animation_system_benchmark_placement_run(model, clip_name, true, iterations);
+    uint64_t cached_us = animation_system_benchmark_placement_run(model, clip_name, false, iterations);
+    
+    debugf("Placement benchmark '%s' (%d updates @ 60 Hz):\n", clip_name, iterations);
+    debugf("  uncached state: %5.1f us/frame\n", (float)uncached_us / iterations);
+    debugf("  cached state  : %5.1f us/frame (%.1f us/frame saved)\n", (float)cached_us / iterations,
+           (float)((int64_t)uncached_us - (int64_t)cached_us) / iterations);
+    
+    t3d_model_free(model);
+}
+#endif
@@ -6,15 +6,74 @@
 #include <t3d/t3danim.h>
 #include <t3d/t3dskeleton.h>
 
+#define ANIM_MAX_CLIPS 16
+#define ANIM_CLIP_NONE -1
+#define ANIM_MAX_LAYERS 2
+
+// How a layer combines with the pose underneath it
+typedef enum {
+    ANIM_LAYER_OVERRIDE,       // Blend toward the layer pose on masked bones
+    ANIM_LAYER_ADDITIVE        // Add the layer's offset from the bind pose on masked bones
+} AnimLayerMode;
+
+// Baked pose tables (.pose files from tools/bakeposes.py)
+#define BAKED_POSE_NAME_LEN 32
+#define BAKED_POSE_MAX_BONES 64
+#define BAKED_CLIP_HAS_SCALE 1
+
+// Clip header as stored in the file (big-endian, read in place)
+typedef struct {
+    char name[BAKED_POSE_NAME_LEN];
+    uint16_t rate;             // Frames per second
+    uint16_t frame_count;
+    uint16_t flags;            // BAKED_CLIP_HAS_SCALE
+    uint16_t reserved;
+    float pos_scale;           // Position units per quantized step
+    uint32_t data_offset;      // Frame data offset from the start of the file
+} BakedClipHeader;
+
+// Loaded .pose file mapped onto one skeleton
+typedef struct {
+    uint8_t* data;             // Whole file
+    const BakedClipHeader* clips;
+    int clip_count;
+    int bone_count;            // Bones per frame in the file
+    int8_t bone_map[BAKED_POSE_MAX_BONES]; // File bone -> skeleton bone (-1 = unused)
+} BakedPoseSet;
+
+// Animation layered over the base pose on a subset of bones
+typedef struct {
+    int clip;                  // Clip driving this layer
+    AnimLayerMode mode;
+    uint32_t bone_mask;        // Bit per bone index the layer affects
+    float weight;              // 0.0 = no effect, 1.0 = full effect
+    float applied_weight;      // Weight used for the last rebuilt pose (-1 forces a rebuild)
+    T3DSkeleton* pose;         // Pose buffer from the shared pool
+    bool active;
+} AnimLayer;
+
 typedef struct {
     T3DModel* model;           // Reference to the model
     T3DSkeleton* skeleton;     // Reference to the skeleton (main)
-    T3DSkeleton* blend_skeleton; // Optional blend skeleton for blending
-    T3DAnim current_anim;      // Currently playing animation
-    T3DAnim blend_anim;        // Blend animation (for transitions)
-    char current_name[64];     // Name of current animation
-    char blend_name[64];       // Name of blend animation
+    T3DSkeleton* blend_skeleton; // Blend pose from the shared pool, acquired on first blend
+    T3DSkeleton* unblended_pose; // Base pose before blending, to reblend when only the factor or blend clip moved
+    T3DAnim clips[ANIM_MAX_CLIPS];          // Every clip in the model, created once at init
+    const char* clip_names[ANIM_MAX_CLIPS]; // Clip names (owned by the model)
+    int clip_count;            // Number of valid entries in clips
+    int current_clip;          // Clip attached to the main skeleton
+    int blend_clip;            // Clip attached to the blend skeleton
     float blend_factor;        // Blend factor (0.0 = current, 1.0 = blend)
+    float applied_blend_factor;// Blend factor used for the last rebuilt pose
+    bool pose_dirty;           // Bone matrices must be rebuilt before the next draw
+    const BakedPoseSet* baked_set; // Baked table driving the base pose (replaces current_clip)
+    int baked_clip;
+    int baked_frame;           // Last frame written (-1 = none yet)
+    float baked_time;
+    bool baked_loop;
+    bool baked_playing;
+    AnimLayer layers[ANIM_MAX_LAYERS]; // Layers applied in order over the base pose
+    uint32_t layer_mask;       // Union of active layer masks
+    T3DSkeleton* base_pose;    // Base pose of masked bones, kept while any layer is active
     bool is_playing;           // Is animation currently playing
     bool is_blending;          // Is currently blending between animations
     bool initialized;          // Initialization flag
@@ -25,6 +84,22 @@ void animation_system_init(AnimationSystem* anim_sys, T3DModel* model, T3DSkelet
 void animation_system_update(AnimationSystem* anim_sys, float delta_time);
 void animation_system_cleanup(AnimationSystem* anim_sys);
 
+// Rebuild bone matrices if the pose changed; call once per rendered frame, not per tick,
+// since each rebuild moves a buffered skeleton on to its next matrix set
+void animation_system_build_matrices(AnimationSystem* anim_sys);
+
+// Bone matrices to draw with this frame (the current buffer of a buffered skeleton)
+T3DMat4FP* animation_system_get_bone_matrices(const T3DSkeleton* skeleton);
+
+// Look up a clip ID by name (returns ANIM_CLIP_NONE if missing), resolve once and cache the result
+int animation_system_find_clip(AnimationSystem* anim_sys, const char* anim_name);
+
+// Animation control by clip ID (no allocation or string compares)
+bool animation_system_play_clip(AnimationSystem* anim_sys, int clip, bool loop);
+bool animation_system_blend_to_clip(AnimationSystem* anim_sys, int target_clip, float blend_speed, bool loop);
+void animation_system_update_position_blend_clip(AnimationSystem* anim_sys, float normalized_position,
+                                                 int left_clip, int right_clip, bool loop);
+
 // Simple animation control by name
 bool animation_system_play(AnimationSystem* anim_sys, const char* anim_name, bool loop);
 void animation_system_stop(AnimationSystem* anim_sys);
@@ -36,6 +111,26 @@ bool animation_system_blend_to(AnimationSystem* anim_sys, const char* target_ani
 void animation_system_set_blend_factor(AnimationSystem* anim_sys, float factor);
 float animation_system_get_blend_factor(AnimationSystem* anim_sys);
 
+// Baked pose tables: fixed-rate frames indexed directly, no keyframe decoding
+BakedPoseSet* baked_pose_set_load(const char* path, const T3DSkeleton* skeleton);
+int baked_pose_set_find_clip(const BakedPoseSet* set, const char* name);
+void baked_pose_set_free(BakedPoseSet* set);
+bool animation_system_play_baked(AnimationSystem* anim_sys, const BakedPoseSet* set, int clip, bool loop);
+
+#ifdef ANIM_BENCHMARK
+// Compare the live T3DAnim path with a baked table for one clip (debug log output)
+void animation_system_benchmark(const char* model_path, const char* clip_name, const char* pose_path);
+// Compare animation updates with the state in uncached vs cached memory (debug log output)
+void animation_system_benchmark_placement(const char* model_path, const char* clip_name);
+#endif
+
+// Layered animation (clips used by a layer must not also play on the base)
+uint32_t animation_system_get_bone_mask(AnimationSystem* anim_sys, const char* root_bone);
+bool animation_system_play_layer(AnimationSystem* anim_sys, int layer, int clip, AnimLayerMode mode,
+                                 uint32_t bone_mask, float weight, bool loop);
+void animation_system_set_layer_weight(AnimationSystem* anim_sys, int layer, float weight);
+void animation_system_stop_layer(AnimationSystem* anim_sys, int layer);
+
 // Position-based blending helper
 void animation_system_update_position_blend(AnimationSystem* anim_sys, float normalized_position, 
                                             const char* left_anim, const char* right_anim, bool loop);
@@ -0,0 +1,106 @@
+/**
+ * @file animscheduler.c
+ * @brief Rate-divided, visibility-culled and budgeted animation updates
+ */
+
+#include "animscheduler.h"
+#include <string.h>
+
+// Longest step handed to a deferred entry, so it does not jump far after being hidden
+#define ANIM_SCHEDULER_MAX_STEP 0.25f
+
+void anim_scheduler_init(AnimScheduler* sched, int budget) {
+    if (!sched) return;
+    
+    memset(sched, 0, sizeof(AnimScheduler));
+    sched->budget = budget;
+}
+
+int anim_scheduler_add(AnimScheduler* sched, AnimationSystem* anim, const T3DVec3* position,
+                       const bool* enabled, float radius, int divisor) {
+    if (!sched || !anim) return -1;
+    if (sched->count >= ANIM_SCHEDULER_MAX_ENTRIES) {
+        debugf("WARNING: Animation scheduler full\n");
+        return -1;
+    }
+    if (divisor < 1) divisor = 1;
+    
+    // Spread entries sharing a divisor over different frames
+    int phase = 0;
+    for (int i = 0; i < sched->count; i++) {
+        if (sched->entries[i].active && sched->entries[i].divisor == divisor) phase++;
+    }
+    
+    int index = sched->count++;
+    AnimSchedulerEntry* e = &sched->entries[index];
+    e->anim = anim;
+    e->position = position;
+    e->enabled = enabled;
+    e->radius = radius;
+    e->divisor = divisor;
+    e->phase = phase % divisor;
+    e->pending_time = 0.0f;
+    e->active = true;
+    return index;
+}
+
+void anim_scheduler_remove(AnimScheduler* sched, int entry) {
+    if (!sched || entry < 0 || entry >= sched->count) return;
+    sched->entries[entry].active = false;
+}
+
+static bool anim_scheduler_is_visible(const AnimSchedulerEntry* e, T3DViewport* viewport) {
+    if (!viewport || !e->position) return true;
+    
+    T3DVec3 min = {{e->position->v[0] - e->radius, e->position->v[1] - e->radius, e->position->v[2] - e->radius}};
+    T3DVec3 max = {{e->position->v[0] + e->radius, e->position->v[1] + e->radius, e->position->v[2] + e->radius}};
+    return t3d_frustum_vs_aabb(&viewport->viewFrustum, &min, &max);
+}
+
+static void anim_scheduler_run(AnimScheduler* sched, AnimSchedulerEntry* e) {
+    float step = e->pending_time;
+    if (step > ANIM_SCHEDULER_MAX_STEP) step = ANIM_SCHEDULER_MAX_STEP;
+    
+    animation_system_update(e->anim, step);
+    e->pending_time = 0.0f;
+    sched->updates_last_frame++;
+}
+
+void anim_scheduler_update(AnimScheduler* sched, float delta_time, T3DViewport* viewport) {
+    if (!sched) return;
+    
+    sched->updates_last_frame = 0;
+    
+    // Collect time for everyone, and run full-rate entries straight away
+    for (int i = 0; i < sched->count; i++) {
+        AnimSchedulerEntry* e = &sched->entries[i];
+        if (!e->active) continue;
+        if (e->enabled && !*e->enabled) continue;
+        
+        e->pending_time += delta_time;
+        if (e->divisor == 1 && anim_scheduler_is_visible(e, viewport)) {
+            anim_scheduler_run(sched, e);
+        }
+    }
+    
+    // Reduced-rate entries run on their phase frame, or later if the budget is spent
+    int budget = sched->budget;
+    for (int n = 0; n < sched->count && budget > 0; n++) {
+        int i = (sched->next_entry + n) % sched->count;
+        AnimSchedulerEntry* e = &sched->entries[i];
+        if (!e->active || e->divisor == 1) continue;
+        if (e->enabled && !*e->enabled) continue;
+        
+        // Due once a full period of time has built up on the phase frame, or overdue
+        bool on_phase = ((sched->frame + e->phase) % e->divisor) == 0;
+        bool overdue = e->pending_time >= delta_time * (e->divisor + 1);
+        if (!on_phase && !overdue) continue;
+        if (!anim_scheduler_is_visible(e, viewport)) continue;
+        
+        anim_scheduler_run(sched, e);
+        budget--;
+        sched->next_entry = (i + 1) % sched->count;
+    }
+    
+    sched->frame++;
+}
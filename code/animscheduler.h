@@ -0,0 +1,48 @@
+#ifndef ANIMSCHEDULER_H
+#define ANIMSCHEDULER_H
+
+#include <libdragon.h>
+#include <t3d/t3d.h>
+#include "animationsystem.h"
+
+#define ANIM_SCHEDULER_MAX_ENTRIES 8
+
+// Reduced-rate updates allowed per frame (full-rate entries are never limited)
+#define ANIM_SCHEDULER_DEFAULT_BUDGET 1
+
+// One animation system driven by the scheduler
+typedef struct {
+    AnimationSystem* anim;
+    const T3DVec3* position;    // Bounds centre (NULL = always visible)
+    const bool* enabled;        // Skip while *enabled is false (NULL = always enabled)
+    float radius;               // Bounds radius around position
+    int divisor;                // Update every Nth frame (1 = full rate)
+    int phase;                  // Frame offset so reduced-rate entries spread across frames
+    float pending_time;         // Time accumulated since the last update
+    bool active;
+} AnimSchedulerEntry;
+
+// Per-level animation scheduler
+typedef struct {
+    AnimSchedulerEntry entries[ANIM_SCHEDULER_MAX_ENTRIES];
+    int count;
+    int budget;                 // Reduced-rate updates per frame
+    int next_entry;             // Round-robin start for reduced-rate entries
+    uint32_t frame;
+    int updates_last_frame;     // Animation updates run on the last frame
+} AnimScheduler;
+
+// Initialize with a per-frame budget for reduced-rate updates
+void anim_scheduler_init(AnimScheduler* sched, int budget);
+
+// Register an animation system (returns entry index or -1 if full)
+int anim_scheduler_add(AnimScheduler* sched, AnimationSystem* anim, const T3DVec3* position,
+                       const bool* enabled, float radius, int divisor);
+
+// Stop driving an entry
+void anim_scheduler_remove(AnimScheduler* sched, int entry);
+
+// Advance due, visible animation systems (viewport may be NULL to skip visibility tests)
+void anim_scheduler_update(AnimScheduler* sched, float delta_time, T3DViewport* viewport);
+
+#endif // ANIMSCHEDULER_H
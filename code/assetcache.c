@@ -0,0 +1,340 @@
+/**
+ * @file assetcache.c
+ * @brief Reference-counted model/sprite cache that survives scene transitions
+ */
+
+#include "assetcache.h"
+#include "bundle.h"
+#include "assetstream.h"
+#include "loadprofiler.h"
+#include <string.h>
+
+typedef enum {
+    ASSET_MODEL,
+    ASSET_SPRITE
+} AssetType;
+
+typedef struct {
+    char path[ASSET_CACHE_PATH_MAX];
+    AssetType type;
+    void* data;             // NULL = free entry
+    int refcount;
+    size_t size;            // Heap bytes taken by the load
+    uint32_t load_us;       // What a reload would cost, credited on every hit
+    uint32_t last_used;     // Use stamp for LRU eviction
+} AssetCacheEntry;
+
+// Asset the cache could not hold; it is owned by its single user and freed on release
+typedef struct {
+    AssetType type;
+    void* data;             // NULL = free entry
+} AssetCacheUncached;
+
+typedef struct {
+    int hits;
+    int misses;
+    uint64_t saved_us;
+    uint64_t load_us;
+} AssetCacheStats;
+
+static AssetCacheEntry cache_entries[ASSET_CACHE_MAX_ENTRIES];
+static AssetCacheUncached cache_uncached[ASSET_CACHE_MAX_UNCACHED];
+static size_t cache_budget = 0;
+static uint32_t cache_stamp = 0;
+static AssetCacheStats cache_total;
+static AssetCacheStats cache_transition;
+static bool cache_in_transition = false;
+
+static size_t heap_used(void) {
+    heap_stats_t stats;
+    sys_get_heap_stats(&stats);
+    return (size_t)stats.used;
+}
+
+static void asset_cache_free_data(AssetType type, void* data) {
+    if (type == ASSET_MODEL) {
+        t3d_model_free((T3DModel*)data);
+    } else {
+        sprite_free((sprite_t*)data);
+    }
+}
+
+static void asset_cache_free_entry(AssetCacheEntry* e) {
+    asset_cache_free_data(e->type, e->data);
+    e->data = NULL;
+    e->refcount = 0;
+    e->size = 0;
+}
+
+static void asset_cache_count(bool hit, uint32_t load_us) {
+    AssetCacheStats* stats[2] = {&cache_total, &cache_transition};
+    for (int i = 0; i < 2; i++) {
+        if (hit) {
+            stats[i]->hits++;
+            stats[i]->saved_us += load_us;
+        } else {
+            stats[i]->misses++;
+            stats[i]->load_us += load_us;
+        }
+    }
+}
+
+// Take a reference on a cached asset; on a miss, NULL with *free_slot set to an empty entry (if any)
+static void* asset_cache_lookup(const char* path, AssetType type, AssetCacheEntry** free_slot) {
+    *free_slot = NULL;
+    for (int i = 0; i < ASSET_CACHE_MAX_ENTRIES; i++) {
+        AssetCacheEntry* e = &cache_entries[i];
+        if (!e->data) {
+            if (!*free_slot) *free_slot = e;
+            continue;
+        }
+        if (e->type == type && strcmp(e->path, path) == 0) {
+            e->refcount++;
+            e->last_used = ++cache_stamp;
+            asset_cache_count(true, e->load_us);
+            return e->data;
+        }
+    }
+    return NULL;
+}
+
+// Record a freshly loaded asset; without a slot (or if the path does not fit) it is tracked
+// uncached so release still frees it, and if that table is full too the load fails
+static void* asset_cache_insert(AssetCacheEntry* slot, const char* path, AssetType type,
+                                void* data, size_t size, uint32_t load_us) {
+    asset_cache_count(false, load_us);
+    
+    if (!slot || strlen(path) >= ASSET_CACHE_PATH_MAX) {
+        for (int i = 0; i < ASSET_CACHE_MAX_UNCACHED; i++) {
+            AssetCacheUncached* u = &cache_uncached[i];
+            if (u->data) continue;
+            
+            debugf("WARNING: Asset cache cannot hold %s, loaded uncached\n", path);
+            u->type = type;
+            u->data = data;
+            return data;
+        }
+        debugf("ERROR: Asset cache cannot hold or track %s, load dropped\n", path);
+        asset_cache_free_data(type, data);
+        return NULL;
+    }
+    
+    strcpy(slot->path, path);
+    slot->type = type;
+    slot->data = data;
+    slot->refcount = 1;
+    slot->size = size;
+    slot->load_us = load_us;
+    slot->last_used = ++cache_stamp;
+    return data;
+}
+
+static void* asset_cache_get(const char* path, AssetType type) {
+    if (!path) return NULL;
+    
+    AssetCacheEntry* slot;
+    void* data = asset_cache_lookup(path, type, &slot);
+    if (data) return data;
+    
+    // Miss: load it, from the mounted bundle when it has the file
+    char bundle_path[ASSET_CACHE_PATH_MAX];
+    const char* load_path = bundle_resolve(path, bundle_path, sizeof(bundle_path));
+#ifdef DEBUG
+    uint32_t packed_size = 0;
+    int level = asset_stream_probe(load_path, &packed_size);
+#endif
+    // The heap growth is the entry's size for the residency budget, so it is measured in every build
+    uint64_t start_us = get_ticks_us();
+    size_t heap_before = heap_used();
+    LOAD_PROFILE(type == ASSET_MODEL ? "model" : "sprite", path,
+                 data = (type == ASSET_MODEL) ? (void*)t3d_model_load(load_path) : (void*)sprite_load(load_path));
+    uint32_t load_us = (uint32_t)(get_ticks_us() - start_us);
+    if (!data) return NULL;
+    
+    size_t heap_after = heap_used();
+    size_t size = heap_after > heap_before ? heap_after - heap_before : 0;
+#ifdef DEBUG
+    asset_stream_record(level, packed_size, size, load_us);
+#endif
+    return asset_cache_insert(slot, path, type, data, size, load_us);
+}
+
+static void* asset_cache_get_from(const char* path, AssetType type, void* image, int image_size, uint32_t load_us) {
+    if (!path || !image) {
+        free(image);
+        return NULL;
+    }
+    
+    AssetCacheEntry* slot;
+    void* data = asset_cache_lookup(path, type, &slot);
+    if (data) {
+        free(image);
+        return data;
+    }
+    
+    // Decompression already happened over earlier frames (load_us); this is the build step
+    LoadMark mark = load_profiler_mark();
+    uint64_t start_us = get_ticks_us();
+    size_t size;
+    if (type == ASSET_SPRITE) {
+        // The sprite lives in the image itself; sprite_load_buf leaves the buffer to the
+        // caller, so mark it owned (as sprite_load does) for sprite_free to release it
+        sprite_t* sprite = sprite_load_buf(image, image_size);
+        if (sprite) {
+            sprite->flags |= SPRITE_FLAGS_OWNEDBUFFER;
+        } else {
+            free(image);
+        }
+        data = sprite;
+        size = image_size;
+    } else {
+        // Tiny3D loads models by path, so the image is served through a one-entry bundle
+        const char* name = strrchr(path, '/');
+        name = name ? name + 1 : path;
+        char image_path[ASSET_CACHE_PATH_MAX];
+        snprintf(image_path, sizeof(image_path), BUNDLE_PREFIX "%s", name);
+        
+        Bundle bundle;
+        BundleEntry entry;
+        bundle_wrap(&bundle, &entry, name, image, image_size);
+        Bundle* previous = bundle_mount(&bundle);
+        size_t heap_before = heap_used();
+        data = t3d_model_load(image_path);
+        size_t heap_after = heap_used();
+        bundle_mount(previous);
+        free(image);
+        size = heap_after > heap_before ? heap_after - heap_before : 0;
+    }
+    load_us += (uint32_t)(get_ticks_us() - start_us);
+    load_profiler_record(type == ASSET_MODEL ? "model-img" : "sprite-img", path, mark);
+    if (!data) return NULL;
+    
+    return asset_cache_insert(slot, path, type, data, size, load_us);
+}
+
+void asset_cache_init(size_t budget_bytes) {
+    memset(cache_entries, 0, sizeof(cache_entries));
+    memset(cache_uncached, 0, sizeof(cache_uncached));
+    memset(&cache_total, 0, sizeof(cache_total));
+    memset(&cache_transition, 0, sizeof(cache_transition));
+    cache_budget = budget_bytes;
+    cache_stamp = 0;
+    cache_in_transition = false;
+}
+
+void asset_cache_cleanup(void) {
+    rspq_wait();
+    for (int i = 0; i < ASSET_CACHE_MAX_ENTRIES; i++) {
+        AssetCacheEntry* e = &cache_entries[i];
+        if (!e->data) continue;
+        if (e->refcount > 0) {
+            debugf("WARNING: Asset cache freeing %s with %d references\n", e->path, e->refcount);
+        }
+        asset_cache_free_entry(e);
+    }
+    for (int i = 0; i < ASSET_CACHE_MAX_UNCACHED; i++) {
+        AssetCacheUncached* u = &cache_uncached[i];
+        if (!u->data) continue;
+        debugf("WARNING: Asset cache freeing an unreleased uncached asset\n");
+        asset_cache_free_data(u->type, u->data);
+        u->data = NULL;
+    }
+}
+
+T3DModel* asset_cache_get_model(const char* path) {
+    return (T3DModel*)asset_cache_get(path, ASSET_MODEL);
+}
+
+sprite_t* asset_cache_get_sprite(const char* path) {
+    return (sprite_t*)asset_cache_get(path, ASSET_SPRITE);
+}
+
+T3DModel* asset_cache_get_model_from(const char* path, void* image, int size, uint32_t load_us) {
+    return (T3DModel*)asset_cache_get_from(path, ASSET_MODEL, image, size, load_us);
+}
+
+sprite_t* asset_cache_get_sprite_from(const char* path, void* image, int size, uint32_t load_us) {
+    return (sprite_t*)asset_cache_get_from(path, ASSET_SPRITE, image, size, load_us);
+}
+
+bool asset_cache_is_resident(const char* path) {
+    if (!path) return false;
+    
+    for (int i = 0; i < ASSET_CACHE_MAX_ENTRIES; i++) {
+        if (cache_entries[i].data && strcmp(cache_entries[i].path, path) == 0) return true;
+    }
+    return false;
+}
+
+void asset_cache_release(const void* asset) {
+    if (!asset) return;
+    
+    for (int i = 0; i < ASSET_CACHE_MAX_ENTRIES; i++) {
+        AssetCacheEntry* e = &cache_entries[i];
+        if (e->data != asset) continue;
+        
+        if (e->refcount > 0) {
+            e->refcount--;
+        } else {
+            debugf("WARNING: Asset cache release of unreferenced %s\n", e->path);
+        }
+        // Freed later by asset_cache_trim, so a scene that wants it back gets a hit
+        return;
+    }
+    
+    // Nothing keeps an uncached asset resident; wait until the RSP is done with it and free it
+    for (int i = 0; i < ASSET_CACHE_MAX_UNCACHED; i++) {
+        AssetCacheUncached* u = &cache_uncached[i];
+        if (u->data != asset) continue;
+        
+        rspq_wait();
+        asset_cache_free_data(u->type, u->data);
+        u->data = NULL;
+        return;
+    }
+    
+    debugf("WARNING: Asset cache release of an asset it does not own\n");
+}
+
+void asset_cache_trim(void) {
+    while (1) {
+        size_t idle_bytes = 0;
+        AssetCacheEntry* lru = NULL;
+        for (int i = 0; i < ASSET_CACHE_MAX_ENTRIES; i++) {
+            AssetCacheEntry* e = &cache_entries[i];
+            if (!e->data || e->refcount > 0) continue;
+            idle_bytes += e->size;
+            if (!lru || e->last_used < lru->last_used) lru = e;
+        }
+        if (!lru || idle_bytes <= cache_budget) return;
+        
+        debugf("Asset cache evicting %s (%u bytes)\n", lru->path, (unsigned)lru->size);
+        asset_cache_free_entry(lru);
+    }
+}
+
+void asset_cache_begin_transition(void) {
+    memset(&cache_transition, 0, sizeof(cache_transition));
+    cache_in_transition = true;
+}
+
+void asset_cache_end_transition(void) {
+    if (!cache_in_transition) return;
+    cache_in_transition = false;
+    
+    // The outgoing scene has been drained (see main.c), so idle assets can go
+    asset_cache_trim();
+    
+    size_t resident = 0;
+    for (int i = 0; i < ASSET_CACHE_MAX_ENTRIES; i++) {
+        resident += cache_entries[i].data ? cache_entries[i].size : 0;
+    }
+    
+    int total_lookups = cache_total.hits + cache_total.misses;
+    debugf("Asset cache: transition %d hits / %d misses, loads %.2f ms, saved %.2f ms | "
+           "total hit rate %.1f%%, saved %.2f ms, resident %u bytes\n",
+           cache_transition.hits, cache_transition.misses,
+           cache_transition.load_us / 1000.0f, cache_transition.saved_us / 1000.0f,
+           total_lookups ? 100.0f * cache_total.hits / total_lookups : 0.0f,
+           cache_total.saved_us / 1000.0f, (unsigned)resident);
+}
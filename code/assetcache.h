@@ -0,0 +1,51 @@
+#ifndef ASSETCACHE_H
+#define ASSETCACHE_H
+
+#include <libdragon.h>
+#include <t3d/t3d.h>
+#include <t3d/t3dmodel.h>
+
+#define ASSET_CACHE_MAX_ENTRIES 32
+#define ASSET_CACHE_PATH_MAX 48
+#define ASSET_CACHE_MAX_UNCACHED 8      // Assets loaded while the cache was full, freed on release
+#define ASSET_CACHE_BUDGET_4MB (512 * 1024)    // Unreferenced bytes kept resident without the Expansion Pak
+#define ASSET_CACHE_BUDGET_8MB (2048 * 1024)   // ... and with it
+
+// Reference-counted asset cache keyed by ROM path
+// Scenes acquire models and sprites through the cache and release them on cleanup.
+// A released asset stays resident, so the next scene (or a death reload of the same
+// level) gets it without touching the ROM. Unreferenced assets are evicted least
+// recently used first, only at transition end, once resident unreferenced bytes
+// exceed the budget. Eviction never runs mid-scene, so nothing the RSP may still be
+// drawing is freed.
+
+// Set up the cache with a residency budget in bytes for unreferenced assets
+void asset_cache_init(size_t budget_bytes);
+
+// Free every cached asset (waits for the RSP)
+void asset_cache_cleanup(void);
+
+// Acquire a model or sprite, loading it on a miss (NULL if the load fails)
+T3DModel* asset_cache_get_model(const char* path);
+sprite_t* asset_cache_get_sprite(const char* path);
+
+// Acquire an asset from a file image already decompressed into RAM (see assetstream.h),
+// load_us being the time that took. The cache takes ownership of image.
+T3DModel* asset_cache_get_model_from(const char* path, void* image, int size, uint32_t load_us);
+sprite_t* asset_cache_get_sprite_from(const char* path, void* image, int size, uint32_t load_us);
+
+// True if the asset at path is loaded (referenced or not)
+bool asset_cache_is_resident(const char* path);
+
+// Release an asset acquired from the cache (NULL is ignored)
+void asset_cache_release(const void* asset);
+
+// Bracket a scene transition: end evicts down to the budget and reports
+// hits, misses and load time saved for the transition
+void asset_cache_begin_transition(void);
+void asset_cache_end_transition(void);
+
+// Evict unreferenced assets until the budget is met (caller ensures the RSP is idle)
+void asset_cache_trim(void);
+
+#endif // ASSETCACHE_H
@@ -0,0 +1,136 @@
+/**
+ * @file assetstream.c
+ * @brief Chunked asset decompression under a time budget, with per-level throughput
+ */
+
+#include "assetstream.h"
+#include <string.h>
+#include <malloc.h>
+
+// libdragon compressed asset header (asset_internal.h); uncompressed files have no header
+typedef struct {
+    char magic[3];              // "DCA"
+    uint8_t version;
+    uint16_t algo;              // Compression level
+    uint16_t flags;
+    uint32_t cmp_size;
+    uint32_t orig_size;
+} AssetHeader;
+
+typedef struct {
+    int loads;
+    uint64_t packed_bytes;
+    uint64_t unpacked_bytes;
+    uint64_t us;
+} AssetStreamStats;
+
+static AssetStreamStats stream_stats[ASSET_STREAM_LEVELS];
+
+int asset_stream_probe(const char* path, uint32_t* packed_size) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return -1;
+    
+    AssetHeader header;
+    int level = 0;
+    if (fread(&header, 1, sizeof(header), f) == sizeof(header) && memcmp(header.magic, "DCA", 3) == 0) {
+        level = header.algo;
+        if (packed_size) *packed_size = header.cmp_size;
+    } else if (packed_size) {
+        fseek(f, 0, SEEK_END);
+        *packed_size = (uint32_t)ftell(f);
+    }
+    fclose(f);
+    return level;
+}
+
+bool asset_stream_open(AssetStream* stream, const char* path) {
+    if (!stream || !path) return false;
+    memset(stream, 0, sizeof(AssetStream));
+    
+    stream->level = asset_stream_probe(path, &stream->packed_size);
+    if (stream->level < 0 || stream->level > ASSET_STREAM_MAX_LEVEL) return false;
+    
+    stream->file = asset_fopen(path, &stream->size);
+    if (!stream->file) return false;
+    
+    stream->buffer = memalign(16, stream->size);
+    if (!stream->buffer) {
+        debugf("WARNING: No memory to stream %s (%d bytes)\n", path, stream->size);
+        fclose(stream->file);
+        stream->file = NULL;
+        return false;
+    }
+    stream->path = path;
+    return true;
+}
+
+bool asset_stream_step(AssetStream* stream, uint32_t budget_us) {
+    if (!stream->file) return true;
+    
+    uint64_t start_us = get_ticks_us();
+    while (stream->done < stream->size) {
+        int chunk = stream->size - stream->done;
+        if (chunk > ASSET_STREAM_CHUNK) chunk = ASSET_STREAM_CHUNK;
+        
+        int got = fread(stream->buffer + stream->done, 1, chunk, stream->file);
+        if (got <= 0) {
+            debugf("WARNING: Decompression of %s stopped at %d/%d bytes\n", stream->path, stream->done, stream->size);
+            stream->failed = true;
+            break;
+        }
+        stream->done += got;
+        
+        if (get_ticks_us() - start_us >= budget_us) break;
+    }
+    stream->busy_us += (uint32_t)(get_ticks_us() - start_us);
+    return stream->failed || stream->done == stream->size;
+}
+
+void* asset_stream_take(AssetStream* stream, int* size) {
+    if (!stream->file || stream->failed || stream->done < stream->size) {
+        asset_stream_close(stream);
+        return NULL;
+    }
+    
+    fclose(stream->file);
+    stream->file = NULL;
+    asset_stream_record(stream->level, stream->packed_size, stream->size, stream->busy_us);
+    
+    void* buffer = stream->buffer;
+    stream->buffer = NULL;
+    if (size) *size = stream->size;
+    return buffer;
+}
+
+void asset_stream_close(AssetStream* stream) {
+    if (stream->file) fclose(stream->file);
+    free(stream->buffer);
+    stream->file = NULL;
+    stream->buffer = NULL;
+}
+
+void asset_stream_record(int level, uint32_t packed_size, uint32_t unpacked_size, uint32_t us) {
+    if (level < 0 || level >= ASSET_STREAM_LEVELS) return;
+    
+    AssetStreamStats* stats = &stream_stats[level];
+    stats->loads++;
+    stats->packed_bytes += packed_size;
+    stats->unpacked_bytes += unpacked_size;
+    stats->us += us;
+}
+
+void asset_stream_report(void) {
+    for (int level = 0; level < ASSET_STREAM_LEVELS; level++) {
+        const AssetStreamStats* stats = &stream_stats[level];
+        if (stats->loads == 0) continue;
+        
+        // Output rate is what a load costs per byte of RAM; input rate is what it saves in ROM reads
+        float seconds = stats->us / 1000000.0f;
+        debugf("Decompression level %d: %d loads, %lu -> %lu bytes (%.0f%%), %.2f ms, %.0f KB/s out, %.0f KB/s in\n",
+               level, stats->loads, (unsigned long)stats->packed_bytes, (unsigned long)stats->unpacked_bytes,
+               stats->unpacked_bytes ? 100.0f * stats->packed_bytes / stats->unpacked_bytes : 0.0f,
+               stats->us / 1000.0f,
+               seconds > 0.0f ? stats->unpacked_bytes / 1024.0f / seconds : 0.0f,
+               seconds > 0.0f ? stats->packed_bytes / 1024.0f / seconds : 0.0f);
+    }
+}
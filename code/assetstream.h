@@ -0,0 +1,51 @@
+#ifndef ASSETSTREAM_H
+#define ASSETSTREAM_H
+
+#include <libdragon.h>
+
+#define ASSET_STREAM_CHUNK 4096         // Bytes decompressed between budget checks
+#define ASSET_STREAM_LEVELS 4           // 0 = stored, 1-3 = libdragon compression levels
+#define ASSET_STREAM_MAX_LEVEL 2        // Highest level libdragon can decompress as a stream
+
+// Incremental asset decompression
+// A compressed asset is read through asset_fopen a chunk at a time, so a large
+// model can be decompressed over several frames under a per-frame budget instead
+// of in one synchronous asset_load. The finished file image is handed to the
+// asset cache, which builds the model or sprite from it.
+// Every load (streamed or not) is also counted per compression level, so
+// asset_stream_report() gives the data to pick each asset's level in the makefile.
+
+typedef struct {
+    const char* path;
+    FILE* file;
+    uint8_t* buffer;            // Decompressed file image
+    int size;                   // Decompressed size
+    int done;                   // Bytes decompressed so far
+    int level;                  // Compression level of the ROM file
+    uint32_t packed_size;       // Bytes stored in ROM
+    uint32_t busy_us;           // Time spent in asset_stream_step
+    bool failed;
+} AssetStream;
+
+// Start decompressing path (false if it cannot be streamed; load it synchronously instead)
+bool asset_stream_open(AssetStream* stream, const char* path);
+
+// Decompress until budget_us has been spent; true once finished (complete or failed)
+bool asset_stream_step(AssetStream* stream, uint32_t budget_us);
+
+// Take the decompressed image (caller frees it) and close the stream; NULL if it failed
+void* asset_stream_take(AssetStream* stream, int* size);
+
+// Abandon a stream and free its buffer
+void asset_stream_close(AssetStream* stream);
+
+// Read a ROM file's compression level and stored size without loading it (-1 if missing)
+int asset_stream_probe(const char* path, uint32_t* packed_size);
+
+// Count a finished load towards the per-level throughput figures
+void asset_stream_record(int level, uint32_t packed_size, uint32_t unpacked_size, uint32_t us);
+
+// Log decompression throughput per compression level
+void asset_stream_report(void);
+
+#endif // ASSETSTREAM_H
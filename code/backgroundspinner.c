@@ -0,0 +1,173 @@
+/**
+ * @file backgroundspinner.c
+ * @brief Rigid background spin baked from a skeletal rotation clip
+ */
+
+#include "backgroundspinner.h"
+#include "matrixring.h"
+#include "mempolicy.h"
+#include <t3d/t3danim.h>
+#include <t3d/t3dskeleton.h>
+#include <string.h>
+#include <math.h>
+
+#define SPINNER_TWO_PI 6.28318530718f
+
+// Fraction of the clip sampled to measure the rate (must turn less than half a revolution)
+#define SPINNER_SAMPLE_FRACTION 0.125f
+
+static T3DQuat quat_mul(const T3DQuat* a, const T3DQuat* b) {
+    T3DQuat r = {{
+        a->v[3] * b->v[0] + a->v[0] * b->v[3] + a->v[1] * b->v[2] - a->v[2] * b->v[1],
+        a->v[3] * b->v[1] - a->v[0] * b->v[2] + a->v[1] * b->v[3] + a->v[2] * b->v[0],
+        a->v[3] * b->v[2] + a->v[0] * b->v[1] - a->v[1] * b->v[0] + a->v[2] * b->v[3],
+        a->v[3] * b->v[3] - a->v[0] * b->v[0] - a->v[1] * b->v[1] - a->v[2] * b->v[2]
+    }};
+    return r;
+}
+
+static T3DQuat quat_from_axis_angle(const T3DVec3* axis, float angle) {
+    float s = sinf(angle * 0.5f);
+    T3DQuat r = {{axis->v[0] * s, axis->v[1] * s, axis->v[2] * s, cosf(angle * 0.5f)}};
+    return r;
+}
+
+static T3DVec3 quat_rotate(const T3DQuat* q, const T3DVec3* v) {
+    // v' = v + 2w(q x v) + 2(q x (q x v))
+    float qx = q->v[0], qy = q->v[1], qz = q->v[2], qw = q->v[3];
+    float tx = 2.0f * (qy * v->v[2] - qz * v->v[1]);
+    float ty = 2.0f * (qz * v->v[0] - qx * v->v[2]);
+    float tz = 2.0f * (qx * v->v[1] - qy * v->v[0]);
+    T3DVec3 r = {{
+        v->v[0] + qw * tx + (qy * tz - qz * ty),
+        v->v[1] + qw * ty + (qz * tx - qx * tz),
+        v->v[2] + qw * tz + (qx * ty - qy * tx)
+    }};
+    return r;
+}
+
+static void background_spinner_build_matrix(const BackgroundSpinner* bs, T3DMat4FP* matrix) {
+    // Rotate about the pivot: translation = pivot - R * pivot
+    T3DQuat rot = quat_from_axis_angle(&bs->axis, bs->angle);
+    T3DVec3 turned = quat_rotate(&rot, &bs->pivot);
+    float scale[3] = {1.0f, 1.0f, 1.0f};
+    float position[3] = {
+        bs->pivot.v[0] - turned.v[0],
+        bs->pivot.v[1] - turned.v[1],
+        bs->pivot.v[2] - turned.v[2]
+    };
+    t3d_mat4fp_from_srt(matrix, scale, rot.v, position);
+}
+
+// Sample the clip at its start and a little later to recover axis, rate and the static pose
+static void background_spinner_bake(BackgroundSpinner* bs, T3DSkeleton* skel, const char* clip_name) {
+    T3DAnim anim = t3d_anim_create(bs->model, clip_name);
+    if (anim.animRef == NULL) {
+        debugf("WARNING: Spinner clip '%s' not found, background stays still\n", clip_name);
+        t3d_skeleton_update(skel);
+        return;
+    }
+    
+    t3d_anim_attach(&anim, skel);
+    t3d_anim_set_looping(&anim, true);
+    t3d_anim_set_playing(&anim, true);
+    t3d_anim_set_time(&anim, 0.0f);
+    t3d_anim_update(&anim, 0.0f);
+    t3d_skeleton_update(skel);
+    
+    // Every bone of these rigs turns together, so the root bone describes the spin
+    T3DQuat q0 = skel->bones[0].rotation;
+    bs->pivot = skel->bones[0].position;
+    
+    float sample_time = anim.animRef->duration * SPINNER_SAMPLE_FRACTION;
+    t3d_anim_update(&anim, sample_time);
+    T3DQuat q1 = skel->bones[0].rotation;
+    t3d_anim_destroy(&anim);
+    
+    // Relative rotation in model space: q1 = rel * q0
+    T3DQuat q0_conj = {{-q0.v[0], -q0.v[1], -q0.v[2], q0.v[3]}};
+    T3DQuat rel = quat_mul(&q1, &q0_conj);
+    if (rel.v[3] < 0.0f) {
+        for (int i = 0; i < 4; i++) rel.v[i] = -rel.v[i];
+    }
+    if (rel.v[3] > 1.0f) rel.v[3] = 1.0f;
+    
+    float angle = 2.0f * acosf(rel.v[3]);
+    float axis_len = sqrtf(rel.v[0] * rel.v[0] + rel.v[1] * rel.v[1] + rel.v[2] * rel.v[2]);
+    if (axis_len < 0.0001f || sample_time <= 0.0f) {
+        debugf("WARNING: Spinner clip '%s' does not rotate\n", clip_name);
+        return;
+    }
+    
+    bs->axis = (T3DVec3){{rel.v[0] / axis_len, rel.v[1] / axis_len, rel.v[2] / axis_len}};
+    bs->rate = angle / sample_time;
+    
+    debugf("Spinner baked '%s': axis (%.2f, %.2f, %.2f), %.3f rad/s\n", clip_name,
+           bs->axis.v[0], bs->axis.v[1], bs->axis.v[2], bs->rate);
+}
+
+bool background_spinner_init(BackgroundSpinner* bs, T3DModel* model, const char* clip_name) {
+    if (!bs) return false;
+    
+    memset(bs, 0, sizeof(BackgroundSpinner));
+    bs->model = model;
+    bs->axis = (T3DVec3){{1.0f, 0.0f, 0.0f}};
+    if (!model) return false;
+    
+    // Skinned backgrounds keep a static pose; the skeleton itself is thrown away
+    const T3DChunkSkeleton* skel_chunk = t3d_model_get_skeleton(model);
+    int bone_count = skel_chunk ? skel_chunk->boneCount : 0;
+    
+    if (bone_count > 0) {
+        bs->bone_matrices = mem_alloc_rsp(sizeof(T3DMat4FP) * bone_count);
+        if (!bs->bone_matrices) {
+            debugf("ERROR: Failed to allocate spinner matrices\n");
+            return false;
+        }
+        
+        T3DSkeleton skel = t3d_skeleton_create(model);
+        background_spinner_bake(bs, &skel, clip_name);
+        
+        memcpy(bs->bone_matrices, skel.boneMatricesFP, sizeof(T3DMat4FP) * bone_count);
+        t3d_skeleton_destroy(&skel);
+    }
+    
+    bs->initialized = true;
+    return true;
+}
+
+void background_spinner_update(BackgroundSpinner* bs, float delta_time) {
+    if (!bs || !bs->initialized || bs->rate == 0.0f) return;
+    
+    bs->angle += bs->rate * delta_time;
+    if (bs->angle >= SPINNER_TWO_PI) bs->angle -= SPINNER_TWO_PI;
+    if (bs->angle < 0.0f) bs->angle += SPINNER_TWO_PI;
+}
+
+void background_spinner_draw(BackgroundSpinner* bs) {
+    if (!bs || !bs->initialized || !bs->model) return;
+    
+    T3DMat4FP* matrix = matrix_ring_alloc();
+    background_spinner_build_matrix(bs, matrix);
+    t3d_matrix_push(matrix);
+    
+    T3DModelDrawConf drawConf = {
+        .userData = NULL,
+        .tileCb = NULL,
+        .filterCb = NULL,
+        .dynTextureCb = NULL,
+        .matrices = bs->bone_matrices
+    };
+    
+    t3d_model_draw_custom(bs->model, drawConf);
+    t3d_matrix_pop(1);
+}
+
+void background_spinner_cleanup(BackgroundSpinner* bs) {
+    if (!bs) return;
+    
+    if (bs->bone_matrices) {
+        mem_free_rsp(bs->bone_matrices);
+    }
+    memset(bs, 0, sizeof(BackgroundSpinner));
+}
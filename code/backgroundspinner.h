@@ -0,0 +1,34 @@
+#ifndef BACKGROUNDSPINNER_H
+#define BACKGROUNDSPINNER_H
+
+#include <libdragon.h>
+#include <t3d/t3d.h>
+#include <t3d/t3dmodel.h>
+
+// Rigidly spinning background (planets, star maps)
+// The model's looping rotation clip is sampled once at load time and replaced
+// by a single model matrix, so no skeleton or animation runs per frame.
+// The spin matrix is rebuilt into the per-frame matrix ring at draw time.
+typedef struct {
+    T3DModel* model;            // Reference to the model (owned by the level)
+    T3DMat4FP* bone_matrices;   // Static pose from the start of the clip (NULL if unskinned)
+    T3DVec3 axis;               // Spin axis in model space
+    T3DVec3 pivot;              // Point the spin turns around
+    float rate;                 // Radians per second
+    float angle;                // Current angle in radians
+    bool initialized;
+} BackgroundSpinner;
+
+// Bake a spinner from the model's rotation clip (rate 0 if the clip is missing)
+bool background_spinner_init(BackgroundSpinner* bs, T3DModel* model, const char* clip_name);
+
+// Advance the spin
+void background_spinner_update(BackgroundSpinner* bs, float delta_time);
+
+// Draw the model with this frame's spin matrix pushed
+void background_spinner_draw(BackgroundSpinner* bs);
+
+// Free matrices (the model is not freed)
+void background_spinner_cleanup(BackgroundSpinner* bs);
+
+#endif // BACKGROUNDSPINNER_H
@@ -0,0 +1,406 @@
+/**
+ * @file bossruntime.c
+ * @brief Table-driven boss state machines shared by every boss encounter
+ */
+
+#include "bossruntime.h"
+#include "mempolicy.h"
+#include "framepipeline.h"
+#include "assetcache.h"
+#include "loadprofiler.h"
+#include <math.h>
+#include <string.h>
+
+/**
+ * Level 2 bomber
+ * Retreat -> approach -> strafe run -> move to wave position -> wave barrage -> repeat
+ */
+enum { BOMBER_RETREAT, BOMBER_APPROACH, BOMBER_STRAFE, BOMBER_TO_WAVE, BOMBER_WAVE };
+
+static const BossStateDef bomber_states[] = {
+    [BOMBER_RETREAT] = {
+        .duration = 3.0f,
+        .move = { .id = BOSS_MOVE_SEEK_ACCEL, .target = {{0.0f, 0.0f, -1000.0f}},
+                  .speed = 180.0f, .speed_limit = 240.0f, .accel = 60.0f, .arrive_dist = 20.0f, .snap = true },
+        .attack = BOSS_ATTACK_NONE,
+        .next = BOMBER_APPROACH
+    },
+    [BOMBER_APPROACH] = {
+        .move = { .id = BOSS_MOVE_SEEK_EASE, .target = {{0.0f, -120.0f, -250.0f}},
+                  .speed = 280.0f, .ramp = 2.5f, .arrive_dist = 30.0f },
+        .attack = BOSS_ATTACK_NONE,
+        .next = BOMBER_STRAFE
+    },
+    [BOMBER_STRAFE] = {
+        .duration = 4.0f,
+        .move = { .id = BOSS_MOVE_STRAFE, .amplitude = 120.0f, .frequency = 3.0f,
+                  .amplitude2 = -15.0f, .frequency2 = 2.0f, .limit = 180.0f },
+        .attack = BULLET_PATTERN_BOMBER_STRAFE, .attack_interval = 0.15f,
+        .next = BOMBER_TO_WAVE
+    },
+    [BOMBER_TO_WAVE] = {
+        .move = { .id = BOSS_MOVE_SEEK_DECEL, .target = {{-200.0f, -40.0f, -420.0f}},
+                  .speed = 160.0f, .speed_limit = 80.0f, .ramp = 2.0f, .arrive_dist = 25.0f },
+        .attack = BOSS_ATTACK_NONE,
+        .next = BOMBER_WAVE
+    },
+    [BOMBER_WAVE] = {
+        .duration = 7.0f,
+        .move = { .id = BOSS_MOVE_WAVE, .target = {{0.0f, -40.0f, -420.0f}},
+                  .amplitude = 200.0f, .frequency = 1.5f, .amplitude2 = 15.0f, .frequency2 = 0.8f,
+                  .tracking = 3.0f },
+        .attack = BULLET_PATTERN_BOMBER_WAVE, .attack_interval = 0.4f,
+        .next = BOMBER_RETREAT
+    }
+};
+
+/**
+ * Level 4 boss
+ * Patrol with slash fans for 10s, stop for a barrage stream, reposition, repeat
+ */
+enum { L4_PATROL, L4_BARRAGE, L4_RECOVER };
+
+static const BossStateDef level4_states[] = {
+    [L4_PATROL] = {
+        .anim = "Move", .anim_loop = true,
+        .duration = 10.0f,
+        .move = { .id = BOSS_MOVE_PATROL, .speed = 0.4f, .amplitude = 120.0f },
+        .attack = BULLET_PATTERN_BOSS_FAN, .attack_interval = 2.0f,
+        .attack_anim = "SlashLeft", .attack_anim_alt = "SlashRight",
+        .next = L4_BARRAGE
+    },
+    [L4_BARRAGE] = {
+        .anim = "SlashBarage", .anim_loop = false,
+        .duration = 3.0f,
+        .move = { .id = BOSS_MOVE_HOLD },
+        .attack = BULLET_PATTERN_BOSS_STREAM, .attack_interval = 0.15f,
+        .next = L4_RECOVER
+    },
+    [L4_RECOVER] = {
+        .anim = "Move", .anim_loop = true,
+        .duration = 3.0f,
+        .move = { .id = BOSS_MOVE_PATROL, .speed = 0.4f, .amplitude = 120.0f },
+        .attack = BOSS_ATTACK_NONE,
+        .next = L4_PATROL
+    }
+};
+
+/**
+ * Level 5 boss
+ * Sweeping machine gun for 8s, then two cannon fans, repeat
+ */
+enum { L5_MACHINEGUN, L5_CANNON };
+
+static const BossStateDef level5_states[] = {
+    [L5_MACHINEGUN] = {
+        .anim = "MachineGun", .anim_loop = true,
+        .duration = 8.0f,
+        .move = { .id = BOSS_MOVE_HOLD },
+        .attack = BULLET_PATTERN_MACHINEGUN_SWEEP, .attack_interval = 0.25f,
+        .next = L5_CANNON
+    },
+    [L5_CANNON] = {
+        .anim = "Cannon", .anim_loop = false,
+        .duration = 3.0f,
+        .move = { .id = BOSS_MOVE_HOLD },
+        .attack = BULLET_PATTERN_CANNON_FAN, .attack_delay = 0.5f, .attack_interval = 1.0f, .attack_max = 2,
+        .next = L5_MACHINEGUN
+    }
+};
+
+static const BossDef boss_defs[BOSS_COUNT] = {
+    [BOSS_LEVEL2_BOMBER] = {
+        .name = "Bomber",
+        .assets = {"rom:/enemy2.t3dm", "spin", true},
+        .spawn_position = {{0.0f, -20.0f, -800.0f}},
+        .scale = 2.5f,
+        .explosion_scale = 1.0f,
+        .anim_divisor = 2, .bounds_radius = 200.0f,
+        .states = bomber_states,
+        .state_count = sizeof(bomber_states) / sizeof(bomber_states[0]),
+        .initial_state = BOMBER_RETREAT
+    },
+    [BOSS_LEVEL4] = {
+        .name = "Level 4 boss",
+        .assets = {"rom:/enemy3.t3dm", "Idle", true},
+        .spawn_position = {{0.0f, -100.0f, -300.0f}},
+        .scale = 1.0f,
+        .explosion_scale = 3.0f,
+        .anim_divisor = 2, .bounds_radius = 200.0f,
+        .reapply_hit_damage = true,
+        .bob_base = -100.0f, .bob_amplitude = 30.0f, .bob_frequency = 1.5f,
+        .states = level4_states,
+        .state_count = sizeof(level4_states) / sizeof(level4_states[0]),
+        .initial_state = L4_PATROL
+    },
+    [BOSS_LEVEL5] = {
+        .name = "Level 5 boss",
+        .assets = {"rom:/enemy4.t3dm", "Move", true},
+        .spawn_position = {{0.0f, -100.0f, -300.0f}},
+        .scale = 1.2f,
+        .explosion_scale = 4.0f,
+        .anim_divisor = 2, .bounds_radius = 200.0f,
+        .reapply_hit_damage = true,
+        .bob_base = -100.0f, .bob_amplitude = 40.0f, .bob_frequency = 1.2f,
+        .states = level5_states,
+        .state_count = sizeof(level5_states) / sizeof(level5_states[0]),
+        .initial_state = L5_MACHINEGUN
+    }
+};
+
+const BossDef* boss_def_get(BossId id) {
+    if (id < 0 || id >= BOSS_COUNT) return NULL;
+    return &boss_defs[id];
+}
+
+/**
+ * Load an animated enemy model, its skeleton and starting animation
+ * Reports the time spent on each step so level load cost stays visible
+ */
+bool boss_runtime_load_requirement(const EnemyAssetRequirement* req, T3DModel** model,
+                                   T3DSkeleton** skeleton, T3DSkeleton* skeleton_storage,
+                                   AnimationSystem* anim) {
+    uint64_t start_us = get_ticks_us();
+    
+    *model = asset_cache_get_model(req->model_path);
+    if (!*model) {
+        debugf("ERROR: Failed to load %s\n", req->model_path);
+        return false;
+    }
+    
+    uint64_t model_us = get_ticks_us();
+    
+    const T3DChunkSkeleton* skelChunk = t3d_model_get_skeleton(*model);
+    if (skelChunk && anim) {
+        *skeleton = skeleton_storage ? skeleton_storage : mem_alloc_cpu(sizeof(T3DSkeleton));
+        LOAD_PROFILE("skeleton", req->model_path, **skeleton = t3d_skeleton_create_buffered(*model, FRAME_PIPELINE_DEPTH));
+        LOAD_PROFILE("anim", req->model_path, animation_system_init(anim, *model, *skeleton));
+        animation_system_play(anim, req->anim_name, req->anim_loop);
+    }
+    
+    uint64_t end_us = get_ticks_us();
+    debugf("Preloaded %s: model %.2f ms, skeleton+anim %.2f ms\n", req->model_path,
+           (model_us - start_us) / 1000.0f, (end_us - model_us) / 1000.0f);
+    return true;
+}
+
+bool boss_runtime_load(BossRuntime* br, const BossDef* def, T3DSkeleton* skeleton_storage) {
+    if (!br || !def) return false;
+    
+    memset(br, 0, sizeof(BossRuntime));
+    br->def = def;
+    br->patrol_progress = 0.5f;
+    br->patrol_right = true;
+    
+    if (!boss_runtime_load_requirement(&def->assets, &br->model, &br->skeleton, skeleton_storage, &br->anim)) {
+        return false;
+    }
+    br->owns_skeleton = (br->skeleton && br->skeleton != skeleton_storage);
+    
+    br->loaded = true;
+    return true;
+}
+
+static void boss_runtime_enter_state(BossRuntime* br, int state) {
+    const BossStateDef* st = &br->def->states[state];
+    
+    br->state = state;
+    br->state_time = 0.0f;
+    br->attack_count = 0;
+    br->next_attack_time = st->attack_delay > 0.0f ? st->attack_delay : st->attack_interval;
+    
+    if (st->attack != BOSS_ATTACK_NONE) {
+        bullet_emitter_reset(&br->emitter, (BulletPatternId)st->attack);
+    }
+    
+    if (st->anim && br->skeleton) {
+        animation_system_play(&br->anim, st->anim, st->anim_loop);
+    }
+}
+
+void boss_runtime_start(BossRuntime* br) {
+    if (!br || !br->loaded) return;
+    boss_runtime_enter_state(br, br->def->initial_state);
+    debugf("%s started in state %d\n", br->def->name, br->state);
+}
+
+void boss_runtime_reset(BossRuntime* br) {
+    if (!br || !br->loaded) return;
+    
+    br->total_time = 0.0f;
+    br->patrol_progress = 0.5f;
+    br->patrol_right = true;
+    boss_runtime_start(br);
+}
+
+/**
+ * Fly towards the state's target using its speed profile
+ * Returns true once within arrival distance
+ */
+static bool boss_move_seek(const BossMovementDef* mv, float t, T3DVec3* position, T3DVec3* velocity, float delta_time) {
+    T3DVec3 to_target = {{
+        mv->target.v[0] - position->v[0],
+        mv->target.v[1] - position->v[1],
+        mv->target.v[2] - position->v[2]
+    }};
+    
+    float dist = sqrtf(to_target.v[0]*to_target.v[0] + to_target.v[1]*to_target.v[1] + to_target.v[2]*to_target.v[2]);
+    if (dist < mv->arrive_dist) return true;
+    
+    float speed;
+    if (mv->id == BOSS_MOVE_SEEK_ACCEL) {
+        // Accelerate from speed towards speed_limit
+        speed = mv->speed + t * mv->accel;
+        if (speed > mv->speed_limit) speed = mv->speed_limit;
+    } else if (mv->id == BOSS_MOVE_SEEK_EASE) {
+        // Ease-in-out for smooth acceleration/deceleration
+        float progress = t / mv->ramp;
+        if (progress > 1.0f) progress = 1.0f;
+        float ease = progress < 0.5f ?
+            2.0f * progress * progress :
+            1.0f - powf(-2.0f * progress + 2.0f, 2.0f) / 2.0f;
+        speed = mv->speed * ease;
+    } else {
+        // Decelerate from speed down to speed_limit
+        speed = mv->speed * (1.0f - (t / mv->ramp));
+        if (speed < mv->speed_limit) speed = mv->speed_limit;
+    }
+    
+    velocity->v[0] = (to_target.v[0] / dist) * speed;
+    velocity->v[1] = (to_target.v[1] / dist) * speed;
+    velocity->v[2] = (to_target.v[2] / dist) * speed;
+    
+    position->v[0] += velocity->v[0] * delta_time;
+    position->v[1] += velocity->v[1] * delta_time;
+    position->v[2] += velocity->v[2] * delta_time;
+    return false;
+}
+
+/**
+ * Apply the current state's movement
+ * Returns true when a seek movement has arrived
+ */
+static bool boss_runtime_move(BossRuntime* br, const BossMovementDef* mv, T3DVec3* position, T3DVec3* velocity, float delta_time) {
+    float t = br->state_time;
+    
+    switch (mv->id) {
+        case BOSS_MOVE_SEEK_ACCEL:
+        case BOSS_MOVE_SEEK_EASE:
+        case BOSS_MOVE_SEEK_DECEL:
+            return boss_move_seek(mv, t, position, velocity, delta_time);
+        
+        case BOSS_MOVE_STRAFE:
+            velocity->v[0] = sinf(t * mv->frequency) * mv->amplitude;
+            velocity->v[1] = mv->amplitude2 * sinf(t * mv->frequency2);
+            velocity->v[2] = 0.0f;
+            
+            position->v[0] += velocity->v[0] * delta_time;
+            position->v[1] += velocity->v[1] * delta_time;
+            
+            // Clamp X position to stay in view
+            if (position->v[0] < -mv->limit) position->v[0] = -mv->limit;
+            if (position->v[0] > mv->limit) position->v[0] = mv->limit;
+            break;
+        
+        case BOSS_MOVE_WAVE:
+        {
+            // Smoothly track a sinusoidal target
+            float target_x = sinf(t * mv->frequency) * mv->amplitude;
+            velocity->v[0] = (target_x - position->v[0]) * mv->tracking;
+            
+            position->v[0] += velocity->v[0] * delta_time;
+            position->v[1] = mv->target.v[1] + sinf(t * mv->frequency2) * mv->amplitude2;
+            position->v[2] = mv->target.v[2];
+            break;
+        }
+        
+        case BOSS_MOVE_PATROL:
+            if (br->patrol_right) {
+                br->patrol_progress += mv->speed * delta_time;
+                if (br->patrol_progress >= 1.0f) {
+                    br->patrol_progress = 1.0f;
+                    br->patrol_right = false;
+                }
+            } else {
+                br->patrol_progress -= mv->speed * delta_time;
+                if (br->patrol_progress <= 0.0f) {
+                    br->patrol_progress = 0.0f;
+                    br->patrol_right = true;
+                }
+            }
+            position->v[0] = (br->patrol_progress - 0.5f) * 2.0f * mv->amplitude;
+            break;
+        
+        case BOSS_MOVE_HOLD:
+        default:
+            break;
+    }
+    
+    return false;
+}
+
+static void boss_runtime_attack(BossRuntime* br, const BossStateDef* st, const T3DVec3* position, ProjectileSystem* ps) {
+    if (st->attack == BOSS_ATTACK_NONE || !ps) return;
+    if (st->attack_max > 0 && br->attack_count >= st->attack_max) return;
+    if (br->state_time < br->next_attack_time) return;
+    
+    br->next_attack_time += st->attack_interval;
+    br->attack_count++;
+    
+    // Pick the attack animation by screen side
+    const char* anim = (position->v[0] > 0.0f && st->attack_anim_alt) ? st->attack_anim_alt : st->attack_anim;
+    if (anim && br->skeleton) {
+        animation_system_play(&br->anim, anim, false);
+    }
+    
+    bullet_pattern_emit(ps, (BulletPatternId)st->attack, position, &br->emitter);
+}
+
+void boss_runtime_update(BossRuntime* br, T3DVec3* position, T3DVec3* velocity, float delta_time, ProjectileSystem* ps) {
+    if (!br || !br->loaded) return;
+    
+    const BossDef* def = br->def;
+    const BossStateDef* st = &def->states[br->state];
+    
+    br->state_time += delta_time;
+    br->total_time += delta_time;
+    
+    bool arrived = boss_runtime_move(br, &st->move, position, velocity, delta_time);
+    
+    // Continuous vertical bob
+    if (def->bob_amplitude != 0.0f) {
+        position->v[1] = def->bob_base + sinf(br->total_time * def->bob_frequency) * def->bob_amplitude;
+    }
+    
+    boss_runtime_attack(br, st, position, ps);
+    
+    bool timed_out = st->duration > 0.0f && br->state_time >= st->duration;
+    if (arrived || timed_out) {
+        if (st->move.snap) {
+            *position = st->move.target;
+            *velocity = (T3DVec3){{0.0f, 0.0f, 0.0f}};
+        }
+        boss_runtime_enter_state(br, st->next);
+    }
+}
+
+void boss_runtime_cleanup(BossRuntime* br) {
+    if (!br) return;
+    
+    if (br->skeleton) {
+        animation_system_cleanup(&br->anim);
+        t3d_skeleton_destroy(br->skeleton);
+        if (br->owns_skeleton) {
+            mem_free_cpu(br->skeleton);
+        }
+        br->skeleton = NULL;
+        br->owns_skeleton = false;
+    }
+    
+    if (br->model) {
+        asset_cache_release(br->model);
+        br->model = NULL;
+    }
+    
+    br->loaded = false;
+}
@@ -0,0 +1,133 @@
+#ifndef BOSSRUNTIME_H
+#define BOSSRUNTIME_H
+
+#include <libdragon.h>
+#include <t3d/t3d.h>
+#include <t3d/t3dmodel.h>
+#include <t3d/t3dskeleton.h>
+#include "animationsystem.h"
+#include "bulletpattern.h"
+#include "projectilesystem.h"
+
+#define BOSS_ATTACK_NONE -1
+
+// Bosses available to levels
+typedef enum {
+    BOSS_LEVEL2_BOMBER,
+    BOSS_LEVEL4,
+    BOSS_LEVEL5,
+    BOSS_COUNT
+} BossId;
+
+// Movement behaviours a boss state can use
+typedef enum {
+    BOSS_MOVE_HOLD,         // Stay in place (bob still applies)
+    BOSS_MOVE_SEEK_ACCEL,   // Fly to target, speed grows by accel per second from speed to speed_limit
+    BOSS_MOVE_SEEK_EASE,    // Fly to target, speed eases in/out up to speed over ramp seconds
+    BOSS_MOVE_SEEK_DECEL,   // Fly to target, speed slows from speed to speed_limit over ramp seconds
+    BOSS_MOVE_STRAFE,       // Sinusoidal sideways velocity with vertical sway, clamped to limit
+    BOSS_MOVE_WAVE,         // Track a sine target across the screen at a fixed depth
+    BOSS_MOVE_PATROL        // Ping-pong side to side across +/- amplitude
+} BossMovementId;
+
+// Assets an animated enemy needs before its first update
+typedef struct {
+    const char* model_path;     // Model file to load
+    const char* anim_name;      // Animation started once loaded
+    bool anim_loop;
+} EnemyAssetRequirement;
+
+// Movement parameters for a boss state
+typedef struct {
+    BossMovementId id;
+    T3DVec3 target;             // Seek target, or wave centre (y, z)
+    float speed;                // Base speed (seek), patrol rate
+    float speed_limit;          // Max (accel) or min (decel) speed
+    float ramp;                 // Seconds for ease/decel profiles
+    float accel;                // Units/s^2 for the accel profile
+    float arrive_dist;          // Seek arrival distance
+    bool snap;                  // Snap onto target when the state ends
+    float amplitude;            // Strafe speed, wave/patrol half-width
+    float frequency;
+    float amplitude2;           // Strafe vertical sway, wave bob height
+    float frequency2;
+    float tracking;             // Wave tracking gain
+    float limit;                // Strafe |x| clamp
+} BossMovementDef;
+
+// One state of a boss state machine
+typedef struct {
+    const char* anim;           // Animation started on entry (NULL keeps the current one)
+    bool anim_loop;
+    float duration;             // Seconds before moving on (0 = until arrival)
+    BossMovementDef move;
+    int attack;                 // BulletPatternId or BOSS_ATTACK_NONE
+    float attack_delay;         // First shot time (0 = one interval)
+    float attack_interval;
+    int attack_max;             // Shots per state (0 = unlimited)
+    const char* attack_anim;    // Animation played when firing (left half of the screen)
+    const char* attack_anim_alt;// Animation played when firing on the right half
+    int next;                   // State entered when this one ends
+} BossStateDef;
+
+// Boss description (stored in ROM)
+typedef struct {
+    const char* name;
+    EnemyAssetRequirement assets;
+    T3DVec3 spawn_position;
+    float scale;
+    float explosion_scale;      // Defeat explosion size (0 = none)
+    int anim_divisor;           // Animation runs every Nth frame (see AnimScheduler)
+    float bounds_radius;        // Visibility radius at scale 1, for skipping off-screen animation
+    bool reapply_hit_damage;    // Run hits through enemy_system_update (Level 4/5 damage tuning)
+    float bob_base;             // Continuous vertical bob: y = base + sin(t * freq) * amp
+    float bob_amplitude;
+    float bob_frequency;
+    const BossStateDef* states;
+    int state_count;
+    int initial_state;
+} BossDef;
+
+// Runtime state shared by every boss
+typedef struct {
+    const BossDef* def;
+    T3DModel* model;
+    T3DSkeleton* skeleton;
+    bool owns_skeleton;         // False when the skeleton struct lives in a caller's arena
+    AnimationSystem anim;
+    int state;
+    float state_time;
+    float total_time;           // Never reset, drives the bob
+    float next_attack_time;
+    int attack_count;
+    float patrol_progress;      // 0-1 across the patrol range
+    bool patrol_right;
+    BulletEmitter emitter;
+    bool loaded;
+} BossRuntime;
+
+// Get the definition for a boss
+const BossDef* boss_def_get(BossId id);
+
+// Load an animated model, its skeleton and starting animation, reporting load times
+// skeleton_storage may be caller-owned memory for the skeleton struct, or NULL to allocate it
+bool boss_runtime_load_requirement(const EnemyAssetRequirement* req, T3DModel** model,
+                                   T3DSkeleton** skeleton, T3DSkeleton* skeleton_storage,
+                                   AnimationSystem* anim);
+
+// Load boss assets (call during scene init), skeleton_storage as above
+bool boss_runtime_load(BossRuntime* br, const BossDef* def, T3DSkeleton* skeleton_storage);
+
+// Enter the initial state
+void boss_runtime_start(BossRuntime* br);
+
+// Rewind timers and movement state and re-enter the initial state (assets stay loaded)
+void boss_runtime_reset(BossRuntime* br);
+
+// Advance state machine, movement and attacks (animation is driven by an AnimScheduler)
+void boss_runtime_update(BossRuntime* br, T3DVec3* position, T3DVec3* velocity, float delta_time, ProjectileSystem* ps);
+
+// Free boss model, skeleton and animation
+void boss_runtime_cleanup(BossRuntime* br);
+
+#endif // BOSSRUNTIME_H
@@ -0,0 +1,134 @@
+/**
+ * @file bulletpattern.c
+ * @brief Data-driven bullet patterns with precomputed direction tables
+ */
+
+#include "bulletpattern.h"
+#include <math.h>
+
+// Bomber turret positions: front, left wing, right wing, rear
+static const T3DVec3 bomber_turrets[4] = {
+    {{  0.0f, -10.0f,  60.0f}},
+    {{-90.0f,  -5.0f,  20.0f}},
+    {{ 90.0f,  -5.0f,  20.0f}},
+    {{  0.0f,   5.0f, -40.0f}}
+};
+
+static const BulletPatternDef pattern_defs[BULLET_PATTERN_COUNT] = {
+    [BULLET_PATTERN_FORWARD] = {
+        .type = PATTERN_FAN, .count = 1, .per_emit = 1
+    },
+    [BULLET_PATTERN_BOMBER_STRAFE] = {
+        .type = PATTERN_FAN, .count = 4, .per_emit = 1, .spread = 0.0f,
+        .offsets = bomber_turrets
+    },
+    [BULLET_PATTERN_BOMBER_WAVE] = {
+        .type = PATTERN_FAN, .count = 7, .per_emit = 7, .spread = 0.15f,
+        .origin = {{0.0f, -15.0f, 30.0f}}, .offset_spacing = 45.0f
+    },
+    [BULLET_PATTERN_BOSS_FAN] = {
+        .type = PATTERN_FAN, .count = 4, .per_emit = 4, .spread = 0.3f,
+        .origin = {{0.0f, 100.0f, 0.0f}}
+    },
+    [BULLET_PATTERN_BOSS_STREAM] = {
+        .type = PATTERN_FAN, .count = 1, .per_emit = 1,
+        .origin = {{0.0f, 100.0f, 0.0f}}
+    },
+    [BULLET_PATTERN_CANNON_FAN] = {
+        .type = PATTERN_FAN, .count = 3, .per_emit = 3, .spread = 0.4f,
+        .origin = {{0.0f, 100.0f, 0.0f}}
+    },
+    [BULLET_PATTERN_MACHINEGUN_SWEEP] = {
+        .type = PATTERN_SPIRAL, .count = 17, .per_emit = 1, .base_angle = -0.64f, .spread = 0.08f,
+        .origin = {{0.0f, 100.0f, 0.0f}}, .ping_pong = true, .start_index = 8
+    }
+};
+
+// Precomputed unit directions and spawn offsets
+static T3DVec3 pattern_dirs[BULLET_PATTERN_COUNT][BULLET_PATTERN_MAX_SHOTS];
+static T3DVec3 pattern_offsets[BULLET_PATTERN_COUNT][BULLET_PATTERN_MAX_SHOTS];
+static bool tables_ready = false;
+
+static float pattern_entry_angle(const BulletPatternDef* def, int i) {
+    switch (def->type) {
+        case PATTERN_SPIRAL:
+            return def->base_angle + i * def->spread;
+        case PATTERN_FAN:
+        default:
+            return def->base_angle + (i - (def->count - 1) * 0.5f) * def->spread;
+    }
+}
+
+void bullet_pattern_init(void) {
+    for (int p = 0; p < BULLET_PATTERN_COUNT; p++) {
+        const BulletPatternDef* def = &pattern_defs[p];
+        assertf(def->count > 0 && def->count <= BULLET_PATTERN_MAX_SHOTS, "Bad bullet pattern %d", p);
+        
+        for (int i = 0; i < def->count; i++) {
+            float angle = pattern_entry_angle(def, i);
+            pattern_dirs[p][i] = (T3DVec3){{sinf(angle), 0.0f, cosf(angle)}};
+            
+            T3DVec3 offset = def->origin;
+            if (def->offsets) {
+                offset.v[0] += def->offsets[i].v[0];
+                offset.v[1] += def->offsets[i].v[1];
+                offset.v[2] += def->offsets[i].v[2];
+            } else {
+                offset.v[0] += (i - (def->count - 1) * 0.5f) * def->offset_spacing;
+            }
+            pattern_offsets[p][i] = offset;
+        }
+    }
+    
+    tables_ready = true;
+    debugf("Bullet pattern tables ready (%d patterns)\n", BULLET_PATTERN_COUNT);
+}
+
+void bullet_emitter_reset(BulletEmitter* emitter, BulletPatternId id) {
+    if (!emitter || id >= BULLET_PATTERN_COUNT) return;
+    emitter->cursor = pattern_defs[id].start_index;
+    emitter->step = 1;
+}
+
+// Advance a spiral cursor, wrapping or bouncing at the table ends
+static void emitter_advance(const BulletPatternDef* def, BulletEmitter* emitter) {
+    emitter->cursor += emitter->step;
+    if (def->ping_pong) {
+        if (emitter->cursor >= def->count - 1) {
+            emitter->cursor = def->count - 1;
+            emitter->step = -1;
+        } else if (emitter->cursor <= 0) {
+            emitter->cursor = 0;
+            emitter->step = 1;
+        }
+    } else if (emitter->cursor >= def->count) {
+        emitter->cursor -= def->count;
+    }
+}
+
+int bullet_pattern_emit(ProjectileSystem* ps, BulletPatternId id, const T3DVec3* position, BulletEmitter* emitter) {
+    if (!ps || !position || id >= BULLET_PATTERN_COUNT || !tables_ready) return 0;
+    
+    const BulletPatternDef* def = &pattern_defs[id];
+    
+    // Whole-pattern emit is a single batch straight from the tables
+    if (def->per_emit >= def->count || !emitter) {
+        return projectile_system_spawn_batch(ps, position, pattern_offsets[id], pattern_dirs[id],
+                                             def->count, PROJECTILE_ENEMY);
+    }
+    
+    // Partial emit: spirals step before firing, cycled fans fire then step
+    int spawned = 0;
+    for (int n = 0; n < def->per_emit; n++) {
+        if (def->type == PATTERN_SPIRAL) {
+            emitter_advance(def, emitter);
+        }
+        int i = emitter->cursor;
+        spawned += projectile_system_spawn_batch(ps, position, &pattern_offsets[id][i], &pattern_dirs[id][i],
+                                                 1, PROJECTILE_ENEMY);
+        if (def->type != PATTERN_SPIRAL) {
+            emitter->cursor = (emitter->cursor + 1) % def->count;
+        }
+    }
+    return spawned;
+}
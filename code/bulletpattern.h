@@ -0,0 +1,58 @@
+#ifndef BULLETPATTERN_H
+#define BULLETPATTERN_H
+
+#include <libdragon.h>
+#include <t3d/t3d.h>
+#include "projectilesystem.h"
+
+#define BULLET_PATTERN_MAX_SHOTS 32
+
+// Pattern shapes
+typedef enum {
+    PATTERN_FAN,        // Shots spread evenly around the forward axis
+    PATTERN_SPIRAL      // Rotating emitter stepping through the table one slice per emit
+} BulletPatternType;
+
+// Patterns used by enemies and bosses
+typedef enum {
+    BULLET_PATTERN_FORWARD,         // Single forward shot
+    BULLET_PATTERN_BOMBER_STRAFE,   // Bomber turrets, one per emit
+    BULLET_PATTERN_BOMBER_WAVE,     // 7-shot spread across the bomber's width
+    BULLET_PATTERN_BOSS_FAN,        // Level 4 boss 4-shot fan
+    BULLET_PATTERN_BOSS_STREAM,     // Level 4 boss barrage stream
+    BULLET_PATTERN_CANNON_FAN,      // Level 5 boss 3-shot cannon fan
+    BULLET_PATTERN_MACHINEGUN_SWEEP,// Level 5 boss ping-pong sweep
+    BULLET_PATTERN_COUNT
+} BulletPatternId;
+
+// Pattern parameters (stored in ROM)
+typedef struct {
+    BulletPatternType type;
+    int count;                  // Number of entries in the direction table
+    int per_emit;               // Shots per emit (count for whole-pattern emits)
+    float base_angle;           // Centre angle (fan) or start angle (spiral), radians
+    float spread;               // Angle between neighbouring shots, radians
+    T3DVec3 origin;             // Offset from the emitter position
+    float offset_spacing;       // Sideways spacing between shot origins
+    const T3DVec3* offsets;     // Explicit per-entry origins (overrides spacing), may be NULL
+    bool ping_pong;             // Spiral walks back and forth instead of wrapping
+    int start_index;            // Spiral entry to start from
+} BulletPatternDef;
+
+// Per-emitter cursor for patterns that emit part of the table at a time
+typedef struct {
+    int cursor;
+    int step;
+} BulletEmitter;
+
+// Precompute direction and offset tables (call once at startup)
+void bullet_pattern_init(void);
+
+// Reset an emitter to the start of a pattern
+void bullet_emitter_reset(BulletEmitter* emitter, BulletPatternId id);
+
+// Emit a pattern from a position, emitter may be NULL for whole-pattern emits
+// Returns the number of projectiles spawned
+int bullet_pattern_emit(ProjectileSystem* ps, BulletPatternId id, const T3DVec3* position, BulletEmitter* emitter);
+
+#endif // BULLETPATTERN_H
@@ -0,0 +1,245 @@
+/**
+ * @file bundle.c
+ * @brief Single-read asset bundles served through a "bnd:/" filesystem
+ */
+
+#include "bundle.h"
+#include <t3d/t3d.h>
+#include <t3d/t3dmodel.h>
+#include <string.h>
+#include <malloc.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#define BUNDLE_VERSION 1
+
+// File header, followed by count BundleEntry records (see tools/packbundle.py)
+typedef struct {
+    char magic[4];
+    uint16_t version;
+    uint16_t count;
+    uint32_t total_size;
+    uint32_t reserved;
+} BundleHeader;
+
+// Open "bnd:/" file
+typedef struct {
+    const BundleEntry* entry;
+    uint32_t pos;
+} BundleFile;
+
+static Bundle* bundle_mounted = NULL;
+static bool bundle_fs_attached = false;
+
+bool bundle_open(Bundle* bundle, const char* path) {
+    if (!bundle || !path) return false;
+    memset(bundle, 0, sizeof(Bundle));
+    
+    uint64_t start_us = get_ticks_us();
+    FILE* f = fopen(path, "rb");
+    if (!f) {
+        debugf("WARNING: Bundle %s not found\n", path);
+        return false;
+    }
+    // Unbuffered, so the read below goes to the cartridge as one large DMA
+    setvbuf(f, NULL, _IONBF, 0);
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    
+    uint8_t* data = size >= (long)sizeof(BundleHeader) ? memalign(BUNDLE_ALIGN, size) : NULL;
+    if (!data || fread(data, 1, size, f) != (size_t)size) {
+        debugf("WARNING: Failed to read bundle %s (%ld bytes)\n", path, size);
+        free(data);
+        fclose(f);
+        return false;
+    }
+    fclose(f);
+    
+    const BundleHeader* header = (const BundleHeader*)data;
+    size_t index_end = sizeof(BundleHeader) + header->count * sizeof(BundleEntry);
+    if (memcmp(header->magic, "BNDL", 4) != 0 || header->version != BUNDLE_VERSION ||
+        header->total_size != (uint32_t)size || index_end > (size_t)size) {
+        debugf("WARNING: Bundle %s is not a version %d bundle\n", path, BUNDLE_VERSION);
+        free(data);
+        return false;
+    }
+    
+    bundle->data = data;
+    bundle->size = (uint32_t)size;
+    bundle->entries = (const BundleEntry*)(data + sizeof(BundleHeader));
+    bundle->count = header->count;
+    bundle->read_us = (uint32_t)(get_ticks_us() - start_us);
+    
+    debugf("Bundle %s: %d entries, %lu bytes read in %.2f ms\n", path, bundle->count,
+           (unsigned long)bundle->size, bundle->read_us / 1000.0f);
+    return true;
+}
+
+void bundle_close(Bundle* bundle) {
+    if (!bundle) return;
+    if (bundle_mounted == bundle) {
+        debugf("WARNING: Closing a mounted bundle\n");
+        bundle_mounted = NULL;
+    }
+    free(bundle->data);
+    memset(bundle, 0, sizeof(Bundle));
+}
+
+const BundleEntry* bundle_find(const Bundle* bundle, const char* name) {
+    if (!bundle || !bundle->data || !name) return NULL;
+    
+    for (int i = 0; i < bundle->count; i++) {
+        if (strncmp(bundle->entries[i].name, name, BUNDLE_NAME_MAX) == 0) {
+            return &bundle->entries[i];
+        }
+    }
+    return NULL;
+}
+
+static void* bundle_fs_open(char* name, int flags) {
+    if ((flags & O_ACCMODE) != O_RDONLY) return NULL;
+    
+    while (*name == '/') name++;
+    const BundleEntry* entry = bundle_find(bundle_mounted, name);
+    if (!entry) return NULL;
+    
+    BundleFile* file = malloc(sizeof(BundleFile));
+    if (!file) return NULL;
+    file->entry = entry;
+    file->pos = 0;
+    return file;
+}
+
+static int bundle_fs_fstat(void* handle, struct stat* st) {
+    BundleFile* file = (BundleFile*)handle;
+    memset(st, 0, sizeof(struct stat));
+    st->st_mode = S_IFREG;
+    st->st_size = file->entry->size;
+    return 0;
+}
+
+static int bundle_fs_lseek(void* handle, int offset, int whence) {
+    BundleFile* file = (BundleFile*)handle;
+    int base = (whence == SEEK_CUR) ? (int)file->pos : (whence == SEEK_END) ? (int)file->entry->size : 0;
+    int pos = base + offset;
+    if (pos < 0) pos = 0;
+    if (pos > (int)file->entry->size) pos = file->entry->size;
+    file->pos = pos;
+    return pos;
+}
+
+static int bundle_fs_read(void* handle, uint8_t* ptr, int len) {
+    BundleFile* file = (BundleFile*)handle;
+    if (!bundle_mounted) return -1;
+    
+    uint32_t left = file->entry->size - file->pos;
+    if ((uint32_t)len > left) len = left;
+    memcpy(ptr, bundle_mounted->data + file->entry->offset + file->pos, len);
+    file->pos += len;
+    return len;
+}
+
+static int bundle_fs_close(void* handle) {
+    free(handle);
+    return 0;
+}
+
+static filesystem_t bundle_fs = {
+    .open = bundle_fs_open,
+    .fstat = bundle_fs_fstat,
+    .lseek = bundle_fs_lseek,
+    .read = bundle_fs_read,
+    .close = bundle_fs_close
+};
+
+void bundle_wrap(Bundle* bundle, BundleEntry* entry, const char* name, void* data, uint32_t size) {
+    memset(entry, 0, sizeof(BundleEntry));
+    strncpy(entry->name, name, BUNDLE_NAME_MAX - 1);
+    entry->offset = 0;
+    entry->size = size;
+    
+    bundle->data = data;
+    bundle->size = size;
+    bundle->entries = entry;
+    bundle->count = 1;
+    bundle->read_us = 0;
+}
+
+Bundle* bundle_mount(Bundle* bundle) {
+    if (!bundle_fs_attached) {
+        attach_filesystem(BUNDLE_PREFIX, &bundle_fs);
+        bundle_fs_attached = true;
+    }
+    Bundle* previous = bundle_mounted;
+    bundle_mounted = bundle;
+    return previous;
+}
+
+void bundle_unmount(void) {
+    bundle_mounted = NULL;
+}
+
+const char* bundle_resolve(const char* path, char* buf, size_t buf_size) {
+    if (!bundle_mounted || !path || strncmp(path, "rom:/", 5) != 0) return path;
+    
+    const char* name = path + 5;
+    if (!bundle_find(bundle_mounted, name)) return path;
+    
+    snprintf(buf, buf_size, BUNDLE_PREFIX "%s", name);
+    return buf;
+}
+
+#ifdef BUNDLE_BENCHMARK
+// Load and free one asset, returning the load time in microseconds
+static uint32_t bundle_benchmark_load(const char* path) {
+    const char* ext = strrchr(path, '.');
+    uint64_t start = get_ticks_us();
+    uint32_t elapsed;
+    
+    if (ext && strcmp(ext, ".t3dm") == 0) {
+        T3DModel* model = t3d_model_load(path);
+        elapsed = (uint32_t)(get_ticks_us() - start);
+        if (model) t3d_model_free(model);
+    } else if (ext && strcmp(ext, ".sprite") == 0) {
+        sprite_t* sprite = sprite_load(path);
+        elapsed = (uint32_t)(get_ticks_us() - start);
+        if (sprite) sprite_free(sprite);
+    } else {
+        int size = 0;
+        void* data = asset_load(path, &size);
+        elapsed = (uint32_t)(get_ticks_us() - start);
+        free(data);
+    }
+    return elapsed;
+}
+
+void bundle_benchmark(const char* bundle_path) {
+    Bundle bundle;
+    if (!bundle_open(&bundle, bundle_path)) return;
+    
+    // Individual files: one DFS lookup, seek and read per asset
+    char path[BUNDLE_NAME_MAX + 8];
+    uint64_t individual_us = 0;
+    for (int i = 0; i < bundle.count; i++) {
+        snprintf(path, sizeof(path), "rom:/%.*s", BUNDLE_NAME_MAX, bundle.entries[i].name);
+        individual_us += bundle_benchmark_load(path);
+    }
+    
+    // Bundle: the single read measured by bundle_open, then loads from RAM
+    uint64_t bundled_us = bundle.read_us;
+    bundle_mount(&bundle);
+    for (int i = 0; i < bundle.count; i++) {
+        snprintf(path, sizeof(path), BUNDLE_PREFIX "%.*s", BUNDLE_NAME_MAX, bundle.entries[i].name);
+        bundled_us += bundle_benchmark_load(path);
+    }
+    bundle_unmount();
+    
+    debugf("Bundle benchmark %s (%d assets, %lu bytes):\n", bundle_path, bundle.count, (unsigned long)bundle.size);
+    debugf("  individual files: %7.2f ms\n", individual_us / 1000.0f);
+    debugf("  bundle          : %7.2f ms (read %.2f ms + parse %.2f ms)\n", bundled_us / 1000.0f,
+           bundle.read_us / 1000.0f, (bundled_us - bundle.read_us) / 1000.0f);
+    
+    bundle_close(&bundle);
+}
+#endif
@@ -0,0 +1,58 @@
+#ifndef BUNDLE_H
+#define BUNDLE_H
+
+#include <libdragon.h>
+
+#define BUNDLE_NAME_MAX 32
+#define BUNDLE_ALIGN 16
+#define BUNDLE_PREFIX "bnd:/"
+
+// Asset bundles (.bnd, packed by tools/packbundle.py)
+// A level's models and sprites are stored back to back in one aligned file, so
+// the whole set comes off the cartridge in a single sequential read instead of
+// one DFS lookup, seek and DMA per asset. While a bundle is mounted, "bnd:/name"
+// opens an entry straight out of the loaded buffer, and the asset cache sends
+// "rom:/name" loads there when the entry exists.
+
+// Index entry, as stored in the file (big-endian, so it is used in place)
+typedef struct {
+    char name[BUNDLE_NAME_MAX];
+    uint32_t offset;            // From the start of the bundle
+    uint32_t size;
+} BundleEntry;
+
+typedef struct {
+    uint8_t* data;              // Whole file, BUNDLE_ALIGN aligned
+    uint32_t size;
+    const BundleEntry* entries; // Points into data
+    int count;
+    uint32_t read_us;           // Time taken by the read
+} Bundle;
+
+// Read a bundle in one pass (false if it is missing or malformed)
+bool bundle_open(Bundle* bundle, const char* path);
+void bundle_close(Bundle* bundle);
+
+// Look up an entry by file name (NULL if absent)
+const BundleEntry* bundle_find(const Bundle* bundle, const char* name);
+
+// Present a buffer already in RAM as a one-entry bundle (data stays owned by the caller,
+// do not bundle_close it)
+void bundle_wrap(Bundle* bundle, BundleEntry* entry, const char* name, void* data, uint32_t size);
+
+// Serve "bnd:/" from this bundle until unmounted (one bundle at a time);
+// returns the bundle it replaces so a short-lived mount can restore it
+Bundle* bundle_mount(Bundle* bundle);
+void bundle_unmount(void);
+
+// Redirect a "rom:/" path into the mounted bundle if it holds that file,
+// otherwise return path unchanged
+const char* bundle_resolve(const char* path, char* buf, size_t buf_size);
+
+#ifdef BUNDLE_BENCHMARK
+// Load every entry of a bundle as individual ROM files, then through the bundle,
+// and log both times (debug log output)
+void bundle_benchmark(const char* bundle_path);
+#endif
+
+#endif // BUNDLE_H
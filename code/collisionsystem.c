@@ -278,22 +278,19 @@ void collision_system_update_box_position(
 }
 
 /**
- * Update all collision boxes of a specific type based on a transform matrix
- * This extracts position from the transform and applies it to the original model-space bounds
+ * Update all collision boxes of a specific type from a world position
+ * The position is applied to the original model-space bounds
  */
 void collision_system_update_boxes_by_type(
     CollisionSystem* system,
     CollisionType type,
-    const T3DMat4FP* transform
+    const T3DVec3* position
 ) {
-    if (!system || !system->initialized || !transform) return;
+    if (!system || !system->initialized || !position) return;
     
-    // Extract position from fixed-point matrix (position is stored in row 3: m[3])
-    // T3DMat4FP has m[4] where each is T3DVec4FP with .i (integer) and .f (fractional) parts
-    // Convert from 16.16 fixed point to float
-    float pos_x = s1616_to_float(transform->m[3].i[0], transform->m[3].f[0]);
-    float pos_y = s1616_to_float(transform->m[3].i[1], transform->m[3].f[1]);
-    float pos_z = s1616_to_float(transform->m[3].i[2], transform->m[3].f[2]);
+    float pos_x = position->v[0];
+    float pos_y = position->v[1];
+    float pos_z = position->v[2];
     
     // Safety check for invalid values
     if (isnan(pos_x) || isnan(pos_y) || isnan(pos_z) || 
@@ -336,15 +333,14 @@ void collision_system_update_boxes_by_range(
     CollisionSystem* system,
     int start_index,
     int count,
-    const T3DMat4FP* transform
+    const T3DVec3* position
 ) {
-    if (!system || !system->initialized || !transform) return;
+    if (!system || !system->initialized || !position) return;
     if (start_index < 0 || start_index >= system->count) return;
     
-    // Extract position from fixed-point matrix
-    float pos_x = s1616_to_float(transform->m[3].i[0], transform->m[3].f[0]);
-    float pos_y = s1616_to_float(transform->m[3].i[1], transform->m[3].f[1]);
-    float pos_z = s1616_to_float(transform->m[3].i[2], transform->m[3].f[2]);
+    float pos_x = position->v[0];
+    float pos_y = position->v[1];
+    float pos_z = position->v[2];
     
     // Safety check for invalid values
     if (isnan(pos_x) || isnan(pos_y) || isnan(pos_z) || 
@@ -398,6 +394,15 @@ void collision_system_remove_box(
     }
 }
 
+/**
+ * Drop boxes appended after count, keeping the allocation
+ */
+void collision_system_truncate(CollisionSystem* system, int count) {
+    if (!system || !system->initialized) return;
+    if (count < 0) count = 0;
+    if (count < system->count) system->count = count;
+}
+
 /**
  * Cleanup the collision system
  */
@@ -88,11 +88,11 @@ void collision_system_update_box_position(
     const T3DVec3* position
 );
 
-// Update all collision boxes of a specific type based on a transform matrix
+// Update all collision boxes of a specific type from a world position
 void collision_system_update_boxes_by_type(
     CollisionSystem* system,
     CollisionType type,
-    const T3DMat4FP* transform
+    const T3DVec3* position
 );
 
 // Update collision boxes by index range (for individual enemies)
@@ -100,7 +100,7 @@ void collision_system_update_boxes_by_range(
     CollisionSystem* system,
     int start_index,
     int count,
-    const T3DMat4FP* transform
+    const T3DVec3* position
 );
 
 // Remove a collision box by name
@@ -109,6 +109,9 @@ void collision_system_remove_box(
     const char* name
 );
 
+// Drop every box from index count onwards (boxes added after a known point)
+void collision_system_truncate(CollisionSystem* system, int count);
+
 // Parse health value from collision box name (e.g., ENEMY_Ship_5 returns 5)
 // Returns parsed health value, or 1 if no valid health suffix found
 int collision_system_parse_health_from_name(const char* name);
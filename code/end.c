@@ -1,9 +1,10 @@
 #include "end.h"
+#include "framepipeline.h"
 #include "scenes.h"
+#include "loadprofiler.h"
 #include <string.h>
 
 void end_init(SceneEnd* scene, rdpq_font_t* font) {
-    scene->last_update_time = 0.0f;
     scene->scene_time = 0.0f;
     scene->scroll_offset = 240.0f; // Start below the screen
     scene->scroll_speed = 30.0f;   // Pixels per second (smooth movement at 60fps)
@@ -15,6 +16,7 @@ void end_init(SceneEnd* scene, rdpq_font_t* font) {
     rdpq_text_register_font(1, scene->font);
     
     // Load credits text file
+    LoadMark credits_mark = load_profiler_mark();
     FILE* fp = fopen("rom:/credits.txt", "r");
     if (!fp) {
         debugf("WARNING: Failed to load credits.txt\n");
@@ -40,9 +42,10 @@ void end_init(SceneEnd* scene, rdpq_font_t* font) {
         fclose(fp);
         debugf("Loaded %d lines from credits.txt\n", scene->line_count);
     }
+    load_profiler_record("text", "rom:/credits.txt", credits_mark);
     
     // Load and start music
-    wav64_open(&scene->music, "rom:/Heartbeat_of_the_Earth.wav64");
+    LOAD_PROFILE("audio", "rom:/Heartbeat_of_the_Earth.wav64", wav64_open(&scene->music, "rom:/Heartbeat_of_the_Earth.wav64"));
     wav64_set_loop(&scene->music, true);
     mixer_ch_set_limits(0, 0, 48000, 0);
     wav64_play(&scene->music, 0);
@@ -51,21 +54,7 @@ void end_init(SceneEnd* scene, rdpq_font_t* font) {
     debugf("End scene initialized\n");
 }
 
-int end_update(SceneEnd* scene) {
-    // Calculate delta time
-    float current_time = (float)((double)get_ticks_us() / 1000000.0);
-    float delta_time;
-    if (scene->last_update_time == 0.0f) {
-        delta_time = 1.0f / 60.0f;
-    } else {
-        delta_time = current_time - scene->last_update_time;
-    }
-    scene->last_update_time = current_time;
-    
-    if (delta_time < 0.0f || delta_time > 0.5f) {
-        delta_time = 1.0f / 60.0f;
-    }
-    
+int end_update(SceneEnd* scene, float delta_time) {
     scene->scene_time += delta_time;
     
     // Scroll credits upward if not complete
@@ -96,7 +85,7 @@ int end_update(SceneEnd* scene) {
 }
 
 void end_render(SceneEnd* scene) {
-    surface_t* disp = display_get();
+    surface_t* disp = frame_pipeline_get_display();
     
     // Clear screen to black
     rdpq_attach(disp, NULL);
@@ -130,7 +119,7 @@ void end_render(SceneEnd* scene) {
         }
     }
     
-    rdpq_detach_show();
+    frame_pipeline_show();
 }
 
 void end_cleanup(SceneEnd* scene) {
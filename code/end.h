@@ -20,14 +20,13 @@ typedef struct {
     bool scroll_complete;
     
     // Timing
-    float last_update_time;
     float scene_time;
 
     wav64_t music;
 } SceneEnd;
 
 void end_init(SceneEnd* scene, rdpq_font_t* font);
-int end_update(SceneEnd* scene);
+int end_update(SceneEnd* scene, float delta_time);
 void end_render(SceneEnd* scene);
 void end_cleanup(SceneEnd* scene);
 
@@ -5,40 +5,32 @@
 
 #include "enemyorchestrator.h"
 #include "projectilesystem.h"
+#include "bulletpattern.h"
+#include "matrixring.h"
+#include "simclock.h"
 #include <stdlib.h>
 #include <string.h>
 #define M_PI 3.14159265358979323846
 
 void enemy_orchestrator_init(EnemyOrchestrator* orch, T3DModel* enemy_model, CollisionSystem* collision_system) {
     orch->enemy_model = enemy_model;
-    orch->bomber_model = NULL;  // Will be loaded for level 2
-    orch->bomber_skeleton = NULL;
-    orch->bomber_anim_system = NULL;  // Pointer, allocated only for level 2
     orch->collision_system = collision_system;
+    orch->collision_base = collision_system ? collision_system->count : 0;
     orch->elapsed_time = 0.0f;
     orch->last_spawn_time = 0.0f;
     orch->active_count = 0;
     orch->wave_count = 0;
-    orch->bomber_phase = 0;
-    orch->bomber_phase_timer = 0.0f;
+    orch->boss_slot = -1;
+    memset(&orch->boss, 0, sizeof(BossRuntime));
+    memset(&orch->explosions, 0, sizeof(ExplosionSystem));
+    memset(orch->enemies, 0, sizeof(orch->enemies));
     
-    // Load explosion model
-    orch->explosion_model = t3d_model_load("rom:/explosion.t3dm");
-    if (!orch->explosion_model) {
-        debugf("WARNING: Failed to load enemy explosion model\n");
-    }
-    
-    // Allocate explosion matrices
-    orch->explosion_matrices = malloc_uncached(sizeof(T3DMat4FP*) * MAX_ENEMIES);
-    for (int i = 0; i < MAX_ENEMIES; i++) {
-        orch->explosion_matrices[i] = malloc_uncached(sizeof(T3DMat4FP));
-        t3d_mat4fp_identity(orch->explosion_matrices[i]);
-    }
+    // Explosions live in their own pool so enemy slots free up immediately
+    explosion_system_init(&orch->explosions);
     
     // Initialize all enemy instances
     for (int i = 0; i < MAX_ENEMIES; i++) {
-        orch->enemies[i].matrix = malloc_uncached(sizeof(T3DMat4FP));
-        t3d_mat4fp_identity(orch->enemies[i].matrix);
+        orch->enemies[i].scale = 1.0f;
         orch->enemies[i].active = false;
         orch->enemies[i].spawn_time = 0.0f;
         orch->enemies[i].collision_start_index = -1;
@@ -46,13 +38,26 @@ void enemy_orchestrator_init(EnemyOrchestrator* orch, T3DModel* enemy_model, Col
         orch->enemies[i].movement_phase = 0;
         orch->enemies[i].phase_timer = 0.0f;
         orch->enemies[i].shoot_timer = 0.0f;
-        orch->enemies[i].has_explosion = false;
-        orch->enemies[i].explosion_timer = 0.0f;
     }
 }
 
-void enemy_orchestrator_spawn_enemy(
-    EnemyOrchestrator* orch,
+/**
+ * Remember every active enemy's position before a simulation tick moves it
+ */
+static void enemy_orchestrator_store_previous(EnemyOrchestrator* orch) {
+    for (int i = 0; i < MAX_ENEMIES; i++) {
+        if (orch->enemies[i].active) {
+            orch->enemies[i].prev_position = orch->enemies[i].position;
+        }
+    }
+}
+
+/**
+ * Spawn an enemy using a given model for collision and scale
+ * Returns the slot index, or -1 if no slot is free
+ */
+static int enemy_orchestrator_spawn_with_model(
+    EnemyOrchestrator* orch, T3DModel* model, float enemy_scale,
     float x, float y, float z,
     float vel_x, float vel_y, float vel_z
 ) {
@@ -63,22 +68,14 @@ void enemy_orchestrator_spawn_enemy(
             
             // Set position and velocity
             enemy->position = (T3DVec3){{x, y, z}};
+            enemy->prev_position = enemy->position;
             enemy->velocity = (T3DVec3){{vel_x, vel_y, vel_z}};
             enemy->spawn_time = orch->elapsed_time;
+            enemy->scale = enemy_scale;
             
-            // Set up transform matrix (use larger scale for bomber)
-            float scale[3] = {1.0f, 1.0f, 1.0f};
-            if (orch->bomber_model != NULL) {
-                scale[0] = scale[1] = scale[2] = 2.5f;  // Bomber is larger
-            }
-            float rotation[3] = {0.0f, 0.0f, 0.0f};
-            float position[3] = {x, y, z};
-            t3d_mat4fp_from_srt_euler(enemy->matrix, scale, rotation, position);
-            
-            // Extract collision boxes for this enemy (use bomber model if available, otherwise standard enemy)
-            T3DModel* collision_model = (orch->bomber_model != NULL) ? orch->bomber_model : orch->enemy_model;
+            // Extract collision boxes for this enemy
             int collision_before = orch->collision_system->count;
-            collision_system_extract_from_model(orch->collision_system, collision_model, "ENEMY_", COLLISION_ENEMY);
+            collision_system_extract_from_model(orch->collision_system, model, "ENEMY_", COLLISION_ENEMY);
             enemy->collision_start_index = collision_before;
             enemy->collision_count = orch->collision_system->count - collision_before;
             
@@ -86,7 +83,7 @@ void enemy_orchestrator_spawn_enemy(
             collision_system_update_boxes_by_range(orch->collision_system, 
                                                    enemy->collision_start_index, 
                                                    enemy->collision_count, 
-                                                   enemy->matrix);
+                                                   &enemy->position);
             
             // Initialize enemy system with health
             int enemy_health = collision_system_get_enemy_health(orch->collision_system);
@@ -96,18 +93,25 @@ void enemy_orchestrator_spawn_enemy(
             enemy->show_hit = false;
             enemy->hit_timer = 0.0f;
             enemy->shoot_timer = 0.0f;
-            enemy->has_explosion = false;
-            enemy->explosion_timer = 0.0f;
             orch->active_count++;
             
             debugf("Spawned enemy %d at (%.1f, %.1f, %.1f) with %d collision boxes\n", 
                    i, x, y, z, enemy->collision_count);
             
-            return;
+            return i;
         }
     }
     
     debugf("WARNING: No enemy slots available!\n");
+    return -1;
+}
+
+void enemy_orchestrator_spawn_enemy(
+    EnemyOrchestrator* orch,
+    float x, float y, float z,
+    float vel_x, float vel_y, float vel_z
+) {
+    enemy_orchestrator_spawn_with_model(orch, orch->enemy_model, 1.0f, x, y, z, vel_x, vel_y, vel_z);
 }
 
 /**
@@ -146,20 +150,10 @@ bool enemy_orchestrator_check_hit(EnemyOrchestrator* orch, const T3DVec3* positi
                 
                 if (enemy->system.health <= 0) {
                     enemy->system.active = false;
-                    enemy->has_explosion = true;
-                    enemy->explosion_timer = 0.25f;
-                    enemy->explosion_position = enemy->position;
-                    
-                    debugf("*** EXPLOSION %d CREATED at (%.1f, %.1f, %.1f) timer=1.0\n", 
-                           i, enemy->explosion_position.v[0], enemy->explosion_position.v[1], enemy->explosion_position.v[2]);
-                    
-                    // Initialize explosion matrix immediately
-                    float exp_scale[3] = {1.0f, 1.0f, 1.0f};
-                    float exp_rotation[3] = {0.0f, 0.0f, 0.0f};
-                    float exp_position[3] = {enemy->explosion_position.v[0], 
-                                            enemy->explosion_position.v[1], 
-                                            enemy->explosion_position.v[2]};
-                    t3d_mat4fp_from_srt_euler(orch->explosion_matrices[i], exp_scale, exp_rotation, exp_position);
+                    // The boss explodes at its own scale when update_boss sees the defeat
+                    if (i != orch->boss_slot) {
+                        explosion_system_spawn(&orch->explosions, enemy->position, 1.0f, 0.25f);
+                    }
                     
                     // Deactivate collision boxes
                     for (int k = enemy->collision_start_index; k < enemy->collision_start_index + enemy->collision_count; k++) {
@@ -185,10 +179,7 @@ bool enemy_orchestrator_check_hit(EnemyOrchestrator* orch, const T3DVec3* positi
  * 5 waves total with varied approach vectors.
  */
 void enemy_orchestrator_update_level1(EnemyOrchestrator* orch, float delta_time) {
-    // Validate delta_time
-    if (delta_time <= 0.0f || delta_time != delta_time || delta_time > 1.0f) {
-        delta_time = 0.0001f;
-    }
+    enemy_orchestrator_store_previous(orch);
     
     orch->elapsed_time += delta_time;
     
@@ -413,17 +404,11 @@ void enemy_orchestrator_update_level1(EnemyOrchestrator* orch, float delta_time)
             }
         }
         
-        // Update transform matrix
-        float scale[3] = {1.0f, 1.0f, 1.0f};
-        float rotation[3] = {0.0f, 0.0f, 0.0f};
-        float position[3] = {enemy->position.v[0], enemy->position.v[1], enemy->position.v[2]};
-        t3d_mat4fp_from_srt_euler(enemy->matrix, scale, rotation, position);
-        
         // Update collision boxes
         collision_system_update_boxes_by_range(orch->collision_system, 
                                                enemy->collision_start_index, 
                                                enemy->collision_count, 
-                                               enemy->matrix);
+                                               &enemy->position);
         
         // Update hit timer
         if (enemy->hit_timer > 0.0f) {
@@ -450,286 +435,7 @@ void enemy_orchestrator_update_level1(EnemyOrchestrator* orch, float delta_time)
     }
     
     // Update explosions
-    for (int i = 0; i < MAX_ENEMIES; i++) {
-        if (orch->enemies[i].has_explosion) {
-            EnemyInstance* enemy = &orch->enemies[i];
-            enemy->explosion_timer -= delta_time;
-            
-            if (enemy->explosion_timer <= 0.0f) {
-                enemy->has_explosion = false;
-                float far_scale[3] = {0.0f, 0.0f, 0.0f};
-                float far_rotation[3] = {0.0f, 0.0f, 0.0f};
-                float far_position[3] = {0.0f, -10000.0f, 0.0f};
-                t3d_mat4fp_from_srt_euler(orch->explosion_matrices[i], far_scale, far_rotation, far_position);
-            }
-        }
-    }
-}
-
-/**
- * Level 2 enemy pattern - Single bomber with alternating attack phases
- * Phase 0: Retreat - fly far away
- * Phase 1: Approach - fly back in aggressively  
- * Phase 2: Strafe - rapid fire attack run
- * Phase 3: Transition to wave - smoothly move to wave position
- * Phase 4: Wave pattern - side-to-side barrage
- */
-void enemy_orchestrator_update_level2(EnemyOrchestrator* orch, float delta_time) {
-    // Load bomber model and setup animation on first call
-    if (!orch->bomber_model) {
-        orch->bomber_model = t3d_model_load("rom:/enemy2.t3dm");
-        if (!orch->bomber_model) {
-            debugf("ERROR: Failed to load enemy2.t3dm bomber model\n");
-            return;
-        }
-        
-        // Initialize skeleton and animation for bomber
-        const T3DChunkSkeleton* skelChunk = t3d_model_get_skeleton(orch->bomber_model);
-        if (skelChunk) {
-            orch->bomber_skeleton = malloc_uncached(sizeof(T3DSkeleton));
-            *orch->bomber_skeleton = t3d_skeleton_create(orch->bomber_model);
-            orch->bomber_anim_system = malloc_uncached(sizeof(AnimationSystem));
-            animation_system_init(orch->bomber_anim_system, orch->bomber_model, orch->bomber_skeleton);
-            animation_system_play(orch->bomber_anim_system, "spin", true);  // Loop spin animation
-        }
-    }
-    
-    // Update bomber animation
-    if (orch->bomber_skeleton && orch->bomber_anim_system) {
-        animation_system_update(orch->bomber_anim_system, delta_time);
-    }
-    
-    orch->elapsed_time += delta_time;
-    
-    // Spawn bomber if none active
-    if (orch->active_count == 0 && orch->wave_count == 0) {
-        // Spawn bomber at distant starting position
-        enemy_orchestrator_spawn_enemy(orch, 0.0f, -20.0f, -800.0f, 0.0f, 0.0f, 0.0f);
-        if (orch->active_count > 0) {
-            EnemyInstance* bomber = &orch->enemies[0];
-            bomber->movement_phase = 0;
-            bomber->phase_timer = 0.0f;
-            // Health is already set from collision box name (ENEMY_bomber_10 = 10 health)
-            orch->bomber_phase = 0;  // Start with retreat
-            orch->bomber_phase_timer = 0.0f;
-            orch->wave_count = 1;
-        }
-    }
-    
-    // Update bomber behavior with realistic physics
-    for (int i = 0; i < MAX_ENEMIES; i++) {
-        if (!orch->enemies[i].active) continue;
-        
-        EnemyInstance* bomber = &orch->enemies[i];
-        bomber->phase_timer += delta_time;
-        orch->bomber_phase_timer += delta_time;
-        
-        switch (orch->bomber_phase) {
-            case 0: // Retreat - fly back to distant position
-            {
-                T3DVec3 retreat_target = {{0.0f, 0.0f, -1000.0f}};
-                T3DVec3 to_target = {{
-                    retreat_target.v[0] - bomber->position.v[0],
-                    retreat_target.v[1] - bomber->position.v[1],
-                    retreat_target.v[2] - bomber->position.v[2]
-                }};
-                
-                float dist = sqrtf(to_target.v[0]*to_target.v[0] + to_target.v[1]*to_target.v[1] + to_target.v[2]*to_target.v[2]);
-                
-                if (dist < 20.0f || bomber->phase_timer > 3.0f) {
-                    // Reached retreat position, prepare to charge
-                    bomber->position = retreat_target;
-                    bomber->velocity = (T3DVec3){{0.0f, 0.0f, 0.0f}};
-                    orch->bomber_phase = 1;
-                    bomber->phase_timer = 0.0f;
-                } else {
-                    // Accelerate away with easing
-                    float speed = 180.0f + (bomber->phase_timer * 60.0f);  // Accelerate from 180 to 240
-                    if (speed > 240.0f) speed = 240.0f;
-                    
-                    bomber->velocity.v[0] = (to_target.v[0] / dist) * speed;
-                    bomber->velocity.v[1] = (to_target.v[1] / dist) * speed;
-                    bomber->velocity.v[2] = (to_target.v[2] / dist) * speed;
-                    
-                    bomber->position.v[0] += bomber->velocity.v[0] * delta_time;
-                    bomber->position.v[1] += bomber->velocity.v[1] * delta_time;
-                    bomber->position.v[2] += bomber->velocity.v[2] * delta_time;
-                }
-                break;
-            }
-            
-            case 1: // Approach - charge in aggressively
-            {
-                T3DVec3 approach_target = {{0.0f, -120.0f, -250.0f}};  // Close to player zone
-                T3DVec3 to_target = {{
-                    approach_target.v[0] - bomber->position.v[0],
-                    approach_target.v[1] - bomber->position.v[1],
-                    approach_target.v[2] - bomber->position.v[2]
-                }};
-                
-                float dist = sqrtf(to_target.v[0]*to_target.v[0] + to_target.v[1]*to_target.v[1] + to_target.v[2]*to_target.v[2]);
-                
-                if (dist < 30.0f) {
-                    // Reached attack position, begin strafe
-                    orch->bomber_phase = 2;
-                    bomber->phase_timer = 0.0f;
-                } else {
-                    // Aggressive approach with realistic acceleration
-                    float progress = bomber->phase_timer / 2.5f;
-                    if (progress > 1.0f) progress = 1.0f;
-                    
-                    // Ease-in-out for smooth acceleration/deceleration
-                    float ease = progress < 0.5f ? 
-                        2.0f * progress * progress : 
-                        1.0f - powf(-2.0f * progress + 2.0f, 2.0f) / 2.0f;
-                    
-                    float speed = 280.0f * ease;  // Max 280 speed
-                    
-                    bomber->velocity.v[0] = (to_target.v[0] / dist) * speed;
-                    bomber->velocity.v[1] = (to_target.v[1] / dist) * speed;
-                    bomber->velocity.v[2] = (to_target.v[2] / dist) * speed;
-                    
-                    bomber->position.v[0] += bomber->velocity.v[0] * delta_time;
-                    bomber->position.v[1] += bomber->velocity.v[1] * delta_time;
-                    bomber->position.v[2] += bomber->velocity.v[2] * delta_time;
-                }
-                break;
-            }
-            
-            case 2: // Strafe - rapid shooting attack
-            {
-                // Strafe side-to-side while shooting
-                float strafe_speed = 120.0f;
-                float strafe_pattern = sinf(bomber->phase_timer * 3.0f);
-                
-                bomber->velocity.v[0] = strafe_pattern * strafe_speed;
-                bomber->velocity.v[1] = -15.0f * sinf(bomber->phase_timer * 2.0f);  // Slight bobbing
-                bomber->velocity.v[2] = 0.0f;
-                
-                bomber->position.v[0] += bomber->velocity.v[0] * delta_time;
-                bomber->position.v[1] += bomber->velocity.v[1] * delta_time;
-                bomber->position.v[2] += bomber->velocity.v[2] * delta_time;
-                
-                // Clamp X position to stay in view
-                if (bomber->position.v[0] < -180.0f) bomber->position.v[0] = -180.0f;
-                if (bomber->position.v[0] > 180.0f) bomber->position.v[0] = 180.0f;
-                
-                // After 4 seconds of strafing, transition to wave pattern
-                if (bomber->phase_timer >= 4.0f) {
-                    orch->bomber_phase = 3;
-                    bomber->phase_timer = 0.0f;
-                }
-                break;
-            }
-            
-            case 3: // Transition to wave pattern position
-            {
-                T3DVec3 wave_target = {{-200.0f, -40.0f, -420.0f}};
-                T3DVec3 to_target = {{
-                    wave_target.v[0] - bomber->position.v[0],
-                    wave_target.v[1] - bomber->position.v[1],
-                    wave_target.v[2] - bomber->position.v[2]
-                }};
-                
-                float dist = sqrtf(to_target.v[0]*to_target.v[0] + to_target.v[1]*to_target.v[1] + to_target.v[2]*to_target.v[2]);
-                
-                if (dist < 25.0f) {
-                    orch->bomber_phase = 4;
-                    bomber->phase_timer = 0.0f;
-                    orch->bomber_phase_timer = 0.0f;
-                } else {
-                    // Smooth transition with deceleration
-                    float speed = 160.0f * (1.0f - (bomber->phase_timer / 2.0f));
-                    if (speed < 80.0f) speed = 80.0f;
-                    
-                    bomber->velocity.v[0] = (to_target.v[0] / dist) * speed;
-                    bomber->velocity.v[1] = (to_target.v[1] / dist) * speed;
-                    bomber->velocity.v[2] = (to_target.v[2] / dist) * speed;
-                    
-                    bomber->position.v[0] += bomber->velocity.v[0] * delta_time;
-                    bomber->position.v[1] += bomber->velocity.v[1] * delta_time;
-                    bomber->position.v[2] += bomber->velocity.v[2] * delta_time;
-                }
-                break;
-            }
-            
-            case 4: // Wave pattern - side-to-side barrage
-            {
-                // Smooth sinusoidal movement
-                float wave_amplitude = 200.0f;
-                float wave_frequency = 1.5f;
-                float target_x = sinf(orch->bomber_phase_timer * wave_frequency) * wave_amplitude;
-                
-                // Smooth velocity interpolation
-                float current_x = bomber->position.v[0];
-                float x_diff = target_x - current_x;
-                bomber->velocity.v[0] = x_diff * 3.0f;  // Smooth tracking
-                
-                bomber->position.v[0] += bomber->velocity.v[0] * delta_time;
-                bomber->position.v[1] = -40.0f + sinf(orch->bomber_phase_timer * 0.8f) * 15.0f;  // Gentle bobbing
-                bomber->position.v[2] = -420.0f;
-                
-                // After 7 seconds, cycle back to retreat
-                if (bomber->phase_timer >= 7.0f) {
-                    orch->bomber_phase = 0;
-                    bomber->phase_timer = 0.0f;
-                    orch->bomber_phase_timer = 0.0f;
-                }
-                break;
-            }
-        }
-        
-        // Update transform matrix with animation bones
-        float scale[3] = {2.5f, 2.5f, 2.5f};  // Bomber is larger
-        float rotation[3] = {0.0f, 0.0f, 0.0f};  // Face player
-        float position[3] = {bomber->position.v[0], bomber->position.v[1], bomber->position.v[2]};
-        t3d_mat4fp_from_srt_euler(bomber->matrix, scale, rotation, position);
-        
-        // Update collision boxes
-        collision_system_update_boxes_by_range(orch->collision_system, 
-                                               bomber->collision_start_index, 
-                                               bomber->collision_count, 
-                                               bomber->matrix);
-        
-        // Update hit timer
-        if (bomber->hit_timer > 0.0f) {
-            bomber->hit_timer -= delta_time;
-            if (bomber->hit_timer <= 0.0f) bomber->show_hit = false;
-        }
-        
-        // Update flash timer
-        if (bomber->system.flash_timer > 0.0f) {
-            bomber->system.flash_timer -= delta_time;
-            if (bomber->system.flash_timer < 0.0f) bomber->system.flash_timer = 0.0f;
-        }
-        
-        // Deactivate if destroyed
-        if (!enemy_system_is_active(&bomber->system)) {
-            for (int j = bomber->collision_start_index; j < bomber->collision_start_index + bomber->collision_count; j++) {
-                if (j < orch->collision_system->count) {
-                    orch->collision_system->boxes[j].active = false;
-                }
-            }
-            bomber->active = false;
-            orch->active_count--;
-        }
-    }
-    
-    // Update explosions
-    for (int i = 0; i < MAX_ENEMIES; i++) {
-        if (orch->enemies[i].has_explosion) {
-            EnemyInstance* enemy = &orch->enemies[i];
-            enemy->explosion_timer -= delta_time;
-            
-            if (enemy->explosion_timer <= 0.0f) {
-                enemy->has_explosion = false;
-                float far_scale[3] = {0.0f, 0.0f, 0.0f};
-                float far_rotation[3] = {0.0f, 0.0f, 0.0f};
-                float far_position[3] = {0.0f, -10000.0f, 0.0f};
-                t3d_mat4fp_from_srt_euler(orch->explosion_matrices[i], far_scale, far_rotation, far_position);
-            }
-        }
-    }
+    explosion_system_update(&orch->explosions, delta_time);
 }
 
 /**
@@ -737,6 +443,7 @@ void enemy_orchestrator_update_level2(EnemyOrchestrator* orch, float delta_time)
  * Enemies spawn individually and move in sine wave pattern across screen
  */
 void enemy_orchestrator_update_level3(EnemyOrchestrator* orch, float delta_time) {
+    enemy_orchestrator_store_previous(orch);
     orch->elapsed_time += delta_time;
     
     // Spawn 15 enemies total, one at a time every 1.2 seconds, alternating from left and right
@@ -766,17 +473,11 @@ void enemy_orchestrator_update_level3(EnemyOrchestrator* orch, float delta_time)
         float age = orch->elapsed_time - enemy->spawn_time;
         enemy->position.v[0] += sinf(age * 3.0f) * 50.0f * delta_time;
         
-        // Update transform matrix
-        float scale[3] = {1.0f, 1.0f, 1.0f};
-        float rotation[3] = {0.0f, 0.0f, 0.0f};
-        float position[3] = {enemy->position.v[0], enemy->position.v[1], enemy->position.v[2]};
-        t3d_mat4fp_from_srt_euler(enemy->matrix, scale, rotation, position);
-        
         // Update collision boxes
         collision_system_update_boxes_by_range(orch->collision_system, 
                                                enemy->collision_start_index, 
                                                enemy->collision_count, 
-                                               enemy->matrix);
+                                               &enemy->position);
         
         // Update hit timer
         if (enemy->hit_timer > 0.0f) {
@@ -816,25 +517,17 @@ void enemy_orchestrator_update_level3(EnemyOrchestrator* orch, float delta_time)
     }
     
     // Update explosions
-    for (int i = 0; i < MAX_ENEMIES; i++) {
-        if (orch->enemies[i].has_explosion) {
-            EnemyInstance* enemy = &orch->enemies[i];
-            enemy->explosion_timer -= delta_time;
-            
-            if (enemy->explosion_timer <= 0.0f) {
-                enemy->has_explosion = false;
-                float far_scale[3] = {0.0f, 0.0f, 0.0f};
-                float far_rotation[3] = {0.0f, 0.0f, 0.0f};
-                float far_position[3] = {0.0f, -10000.0f, 0.0f};
-                t3d_mat4fp_from_srt_euler(orch->explosion_matrices[i], far_scale, far_rotation, far_position);
-            }
-        }
-    }
+    explosion_system_update(&orch->explosions, delta_time);
 }
 
-T3DMat4FP* enemy_orchestrator_get_matrix(EnemyOrchestrator* orch, int index) {
+T3DMat4FP* enemy_orchestrator_get_matrix(EnemyOrchestrator* orch, int index, float alpha) {
     if (index >= 0 && index < MAX_ENEMIES) {
-        return orch->enemies[index].matrix;
+        const EnemyInstance* enemy = &orch->enemies[index];
+        float scale[3] = {enemy->scale, enemy->scale, enemy->scale};
+        float rotation[3] = {0.0f, 0.0f, 0.0f};
+        T3DVec3 pos = sim_lerp_vec3(&enemy->prev_position, &enemy->position, alpha);
+        float position[3] = {pos.v[0], pos.v[1], pos.v[2]};
+        return matrix_ring_srt_euler(scale, rotation, position);
     }
     return NULL;
 }
@@ -858,47 +551,12 @@ int enemy_orchestrator_get_active_count(EnemyOrchestrator* orch) {
 }
 
 void enemy_orchestrator_cleanup(EnemyOrchestrator* orch) {
-    // Free explosion model
-    if (orch->explosion_model) {
-        t3d_model_free(orch->explosion_model);
-        orch->explosion_model = NULL;
-    }
-    
-    // Free bomber model and skeleton
-    if (orch->bomber_model) {
-        t3d_model_free(orch->bomber_model);
-        orch->bomber_model = NULL;
-    }
-    
-    if (orch->bomber_anim_system) {
-        free_uncached(orch->bomber_anim_system);
-        orch->bomber_anim_system = NULL;
-    }
-    
-    if (orch->bomber_skeleton) {
-        t3d_skeleton_destroy(orch->bomber_skeleton);
-        free_uncached(orch->bomber_skeleton);
-        orch->bomber_skeleton = NULL;
-    }
+    // Free explosion pool
+    explosion_system_cleanup(&orch->explosions);
     
-    // Free explosion matrices
-    if (orch->explosion_matrices) {
-        for (int i = 0; i < MAX_ENEMIES; i++) {
-            if (orch->explosion_matrices[i]) {
-                free_uncached(orch->explosion_matrices[i]);
-            }
-        }
-        free_uncached(orch->explosion_matrices);
-        orch->explosion_matrices = NULL;
-    }
-    
-    // Free enemy matrices
-    for (int i = 0; i < MAX_ENEMIES; i++) {
-        if (orch->enemies[i].matrix) {
-            free_uncached(orch->enemies[i].matrix);
-            orch->enemies[i].matrix = NULL;
-        }
-    }
+    // Free boss model, skeleton and animation
+    boss_runtime_cleanup(&orch->boss);
+    orch->boss_slot = -1;
 }
 
 /**
@@ -923,68 +581,8 @@ void enemy_orchestrator_spawn_projectiles_level1(EnemyOrchestrator* orch, void*
             if (enemy->shoot_timer >= 1.0f) {
                 enemy->shoot_timer = 0.0f;
                 
-                // Spawn projectile at enemy position
-                T3DVec3 spawn_pos = enemy->position;
-                
-                // Shoot towards player (assuming player at 0, -150, 0)
-                T3DVec3 shoot_direction = {{0.0f, 0.0f, 1.0f}};  // Forward towards player
-                
-                projectile_system_spawn(ps, spawn_pos, shoot_direction, PROJECTILE_ENEMY);
-            }
-        }
-    }
-}
-
-void enemy_orchestrator_spawn_projectiles_level2(EnemyOrchestrator* orch, void* projectile_system_ptr, float delta_time) {
-    if (!orch || !projectile_system_ptr) return;
-    
-    ProjectileSystem* ps = (ProjectileSystem*)projectile_system_ptr;
-    
-    for (int i = 0; i < MAX_ENEMIES; i++) {
-        if (!orch->enemies[i].active) continue;
-        
-        EnemyInstance* bomber = &orch->enemies[i];
-        bomber->shoot_timer += delta_time;
-        
-        // Phase 2: Strafe attack - rapid fire from 4 locations
-        if (orch->bomber_phase == 2) {
-            if (bomber->shoot_timer >= 0.15f) {  // Very rapid fire during strafe
-                bomber->shoot_timer = 0.0f;
-                
-                T3DVec3 shoot_dir = {{0.0f, 0.0f, 1.0f}};  // Forward
-                
-                // 4 spawn positions: front, left wing, right wing, rear
-                T3DVec3 positions[4] = {
-                    {{bomber->position.v[0], bomber->position.v[1] - 10.0f, bomber->position.v[2] + 60.0f}},   // Front turret
-                    {{bomber->position.v[0] - 90.0f, bomber->position.v[1] - 5.0f, bomber->position.v[2] + 20.0f}},  // Left wing
-                    {{bomber->position.v[0] + 90.0f, bomber->position.v[1] - 5.0f, bomber->position.v[2] + 20.0f}},  // Right wing
-                    {{bomber->position.v[0], bomber->position.v[1] + 5.0f, bomber->position.v[2] - 40.0f}}     // Rear turret
-                };
-                
-                // Cycle through positions
-                int pos_index = ((int)(orch->elapsed_time * 6.67f)) % 4;
-                projectile_system_spawn(ps, positions[pos_index], shoot_dir, PROJECTILE_ENEMY);
-            }
-        }
-        // Phase 4: Wave pattern - spread barrage
-        else if (orch->bomber_phase == 4) {
-            if (bomber->shoot_timer >= 0.4f) {  // Shoot waves every 0.4 seconds
-                bomber->shoot_timer = 0.0f;
-                
-                // Spawn 7 projectiles in a wave pattern
-                for (int j = -3; j <= 3; j++) {
-                    T3DVec3 spawn_pos = {{
-                        bomber->position.v[0] + j * 45.0f,
-                        bomber->position.v[1] - 15.0f,
-                        bomber->position.v[2] + 30.0f
-                    }};
-                    
-                    // Angled shots creating wave spread
-                    float angle = j * 0.15f;  // Spread pattern
-                    T3DVec3 shoot_dir = {{sinf(angle), 0.0f, cosf(angle)}};
-                    
-                    projectile_system_spawn(ps, spawn_pos, shoot_dir, PROJECTILE_ENEMY);
-                }
+                // Forward shot towards the player
+                bullet_pattern_emit(ps, BULLET_PATTERN_FORWARD, &enemy->position, NULL);
             }
         }
     }
@@ -1005,13 +603,8 @@ void enemy_orchestrator_spawn_projectiles_level3(EnemyOrchestrator* orch, void*
         if (enemy->shoot_timer >= 0.8f) {
             enemy->shoot_timer = 0.0f;
             
-            // Spawn projectile at enemy position
-            T3DVec3 spawn_pos = enemy->position;
-            
-            // Shoot towards player
-            T3DVec3 shoot_direction = {{0.0f, 0.0f, 1.0f}};
-            
-            projectile_system_spawn(ps, spawn_pos, shoot_direction, PROJECTILE_ENEMY);
+            // Forward shot towards the player
+            bullet_pattern_emit(ps, BULLET_PATTERN_FORWARD, &enemy->position, NULL);
         }
     }
 }
@@ -1020,537 +613,164 @@ bool enemy_orchestrator_all_waves_complete(EnemyOrchestrator* orch, int max_wave
     return orch->wave_count >= max_waves && orch->active_count == 0;
 }
 
-T3DMat4FP* enemy_orchestrator_get_explosion_matrix(EnemyOrchestrator* orch, int index) {
-    if (index >= 0 && index < MAX_ENEMIES && orch->enemies[index].has_explosion) {
-        return orch->explosion_matrices[index];
-    }
-    return NULL;
+ExplosionSystem* enemy_orchestrator_get_explosions(EnemyOrchestrator* orch) {
+    return &orch->explosions;
 }
 
-bool enemy_orchestrator_has_explosion(EnemyOrchestrator* orch, int index) {
-    if (index >= 0 && index < MAX_ENEMIES) {
-        return orch->enemies[index].has_explosion;
-    }
-    return false;
+/**
+ * Spawn the loaded boss into a free slot
+ */
+static void enemy_orchestrator_spawn_boss(EnemyOrchestrator* orch) {
+    const BossDef* def = orch->boss.def;
+    const T3DVec3* pos = &def->spawn_position;
+    orch->boss_slot = enemy_orchestrator_spawn_with_model(orch, orch->boss.model, def->scale,
+                                                          pos->v[0], pos->v[1], pos->v[2],
+                                                          0.0f, 0.0f, 0.0f);
+    if (orch->boss_slot < 0) return;
+    
+    EnemyInstance* boss = &orch->enemies[orch->boss_slot];
+    boss->movement_phase = 0;
+    boss->phase_timer = 0.0f;
+    orch->wave_count = 1;
 }
 
-T3DModel* enemy_orchestrator_get_explosion_model(EnemyOrchestrator* orch) {
-    return orch->explosion_model;
+/**
+ * Load a boss and spawn it into an enemy slot
+ * Call during scene init after enemy_orchestrator_init
+ */
+void enemy_orchestrator_init_boss(EnemyOrchestrator* orch, BossId id) {
+    const BossDef* def = boss_def_get(id);
+    if (!orch || !def) return;
+    
+    if (!boss_runtime_load(&orch->boss, def, &orch->boss_skeleton)) {
+        return;
+    }
+    
+    enemy_orchestrator_spawn_boss(orch);
+    if (orch->boss_slot < 0) return;
+    
+    boss_runtime_start(&orch->boss);
+    debugf("%s initialized: %d HP\n", def->name, orch->enemies[orch->boss_slot].system.health);
 }
 
-// Level 4 Boss Implementation
-void enemy_orchestrator_init_level4_boss(EnemyOrchestrator* orch, CollisionSystem* collision_system) {
-    orch->enemy_model = NULL;
-    orch->bomber_model = NULL;
-    orch->bomber_skeleton = NULL;
-    orch->bomber_anim_system = NULL;
-    orch->collision_system = collision_system;
+/**
+ * Restart the level's enemies in place
+ * Enemy collision boxes are dropped back to collision_base and the boss is respawned
+ */
+void enemy_orchestrator_reset(EnemyOrchestrator* orch) {
+    if (!orch) return;
+    
+    collision_system_truncate(orch->collision_system, orch->collision_base);
+    explosion_system_clear(&orch->explosions);
+    
     orch->elapsed_time = 0.0f;
     orch->last_spawn_time = 0.0f;
     orch->active_count = 0;
     orch->wave_count = 0;
-    orch->bomber_phase = 0;
-    orch->bomber_phase_timer = 0.0f;
-    
-    // Load explosion model
-    orch->explosion_model = t3d_model_load("rom:/explosion.t3dm");
-    
-    // Allocate explosion matrices
-    orch->explosion_matrices = malloc_uncached(sizeof(T3DMat4FP*) * MAX_ENEMIES);
-    for (int i = 0; i < MAX_ENEMIES; i++) {
-        orch->explosion_matrices[i] = malloc_uncached(sizeof(T3DMat4FP));
-        t3d_mat4fp_identity(orch->explosion_matrices[i]);
-    }
+    orch->boss_slot = -1;
     
-    // Initialize all enemy slots
     for (int i = 0; i < MAX_ENEMIES; i++) {
-        orch->enemies[i].matrix = malloc_uncached(sizeof(T3DMat4FP));
-        t3d_mat4fp_identity(orch->enemies[i].matrix);
-        orch->enemies[i].active = false;
-        orch->enemies[i].collision_start_index = -1;
-        orch->enemies[i].collision_count = 0;
-        orch->enemies[i].movement_phase = 0;
-        orch->enemies[i].phase_timer = 0.0f;
-        orch->enemies[i].shoot_timer = 0.0f;
-        orch->enemies[i].has_explosion = false;
-        orch->enemies[i].explosion_timer = 0.0f;
-    }
-    
-    // Load boss model
-    orch->boss_model = t3d_model_load("rom:/enemy3.t3dm");
-    if (!orch->boss_model) {
-        debugf("ERROR: Failed to load enemy3.t3dm for boss\n");
-        return;
-    }
-    
-    // Initialize boss skeleton and animation
-    const T3DChunkSkeleton* skelChunk = t3d_model_get_skeleton(orch->boss_model);
-    if (skelChunk) {
-        orch->boss_skeleton = malloc_uncached(sizeof(T3DSkeleton));
-        *orch->boss_skeleton = t3d_skeleton_create(orch->boss_model);
-        animation_system_init(&orch->boss_anim, orch->boss_model, orch->boss_skeleton);
-        animation_system_play(&orch->boss_anim, "Idle", true);
+        EnemyInstance* enemy = &orch->enemies[i];
+        enemy->scale = 1.0f;
+        enemy->active = false;
+        enemy->spawn_time = 0.0f;
+        enemy->collision_start_index = -1;
+        enemy->collision_count = 0;
+        enemy->movement_phase = 0;
+        enemy->phase_timer = 0.0f;
+        enemy->shoot_timer = 0.0f;
+        enemy->show_hit = false;
+        enemy->hit_timer = 0.0f;
+    }
+    
+    if (orch->boss.loaded) {
+        enemy_orchestrator_spawn_boss(orch);
+        boss_runtime_reset(&orch->boss);
     }
-    
-    // Initialize boss movement state
-    orch->boss_side_progress = 0.5f;
-    orch->boss_moving_right = true;
-    orch->boss_barrage_cooldown = 10.0f;
-    orch->boss_spin_timer = 0.0f;
-    
-    // Spawn boss in slot 0
-    EnemyInstance* boss = &orch->enemies[0];
-    boss->position = (T3DVec3){{0.0f, -100.0f, -300.0f}};
-    boss->velocity = (T3DVec3){{0.0f, 0.0f, 0.0f}};
-    
-    // Setup transform with scale 1.0
-    float scale[3] = {1.0f, 1.0f, 1.0f};
-    float rotation[3] = {0.0f, 0.0f, 0.0f};
-    float position[3] = {0.0f, -100.0f, -300.0f};
-    t3d_mat4fp_from_srt_euler(boss->matrix, scale, rotation, position);
-    
-    // Extract collision
-    int collision_before = collision_system->count;
-    collision_system_extract_from_model(collision_system, orch->boss_model, "ENEMY_", COLLISION_ENEMY);
-    boss->collision_start_index = collision_before;
-    boss->collision_count = collision_system->count - collision_before;
-    collision_system_update_boxes_by_range(collision_system, boss->collision_start_index, boss->collision_count, boss->matrix);
-    
-    // Initialize with health from mesh name
-    int boss_health = collision_system_get_enemy_health(collision_system);
-    enemy_system_init(&boss->system, boss_health);
-    boss->active = true;
-    boss->show_hit = false;
-    boss->hit_timer = 0.0f;
-    boss->shoot_timer = 0.0f;
-    boss->movement_phase = 0;
-    boss->phase_timer = 0.0f;
-    
-    orch->active_count = 1;
-    debugf("Boss initialized: %d HP\n", boss_health);
 }
 
-void enemy_orchestrator_update_level4_boss(EnemyOrchestrator* orch, float delta_time, void* projectile_system_ptr) {
-    if (delta_time <= 0.0f || delta_time > 1.0f) delta_time = 0.016f;
+/**
+ * Shared boss update: health, state machine, movement, attacks, transform
+ */
+void enemy_orchestrator_update_boss(EnemyOrchestrator* orch, float delta_time, void* projectile_system_ptr) {
+    enemy_orchestrator_store_previous(orch);
     
     ProjectileSystem* ps = (ProjectileSystem*)projectile_system_ptr;
     orch->elapsed_time += delta_time;
     
-    if (!orch->boss_model || !orch->boss_skeleton) return;
+    // Explosions keep playing after the boss is gone
+    explosion_system_update(&orch->explosions, delta_time);
+    
+    if (!orch->boss.loaded || orch->boss_slot < 0) return;
     
-    EnemyInstance* boss = &orch->enemies[0];
+    const BossDef* def = orch->boss.def;
+    EnemyInstance* boss = &orch->enemies[orch->boss_slot];
     if (!boss->active) return;
     
     // Update health system
-    enemy_system_update(&boss->system, delta_time, &boss->show_hit, &boss->hit_timer, 
-                       orch->collision_system, boss->system.last_damage_taken);
-    
-    // Check defeat
-    if (!boss->system.active && !boss->has_explosion) {
-        boss->active = false;
-        boss->has_explosion = true;
-        boss->explosion_timer = 0.25f;
-        boss->explosion_position = boss->position;
-        orch->active_count = 0;
-        
-        float exp_scale[3] = {3.0f, 3.0f, 3.0f};
-        float exp_rotation[3] = {0.0f, 0.0f, 0.0f};
-        float exp_position[3] = {boss->explosion_position.v[0], boss->explosion_position.v[1], boss->explosion_position.v[2]};
-        t3d_mat4fp_from_srt_euler(orch->explosion_matrices[0], exp_scale, exp_rotation, exp_position);
-        return;
-    }
-    
-    // Update explosion
-    if (boss->has_explosion) {
-        boss->explosion_timer -= delta_time;
-        if (boss->explosion_timer <= 0.0f) {
-            boss->has_explosion = false;
+    if (def->reapply_hit_damage) {
+        enemy_system_update(&boss->system, delta_time, &boss->show_hit, &boss->hit_timer, 
+                           orch->collision_system, boss->system.last_damage_taken);
+    } else {
+        if (boss->hit_timer > 0.0f) {
+            boss->hit_timer -= delta_time;
+            if (boss->hit_timer <= 0.0f) boss->show_hit = false;
         }
-        return;
-    }
-    
-    // Immediate phase transitions
-    if (boss->movement_phase == 0) {
-        boss->movement_phase = 1;
-        animation_system_play(&orch->boss_anim, "Move", true);
-    }
-    
-    // Side-to-side movement (both phases)
-    const float move_speed = 0.4f;
-    const float move_range = 120.0f;
-    
-    bool is_barraging = (boss->movement_phase == 2 && orch->boss_barrage_cooldown > 0.0f && orch->boss_barrage_cooldown < 3.0f);
-    
-    if (!is_barraging) {
-        if (orch->boss_moving_right) {
-            orch->boss_side_progress += move_speed * delta_time;
-            if (orch->boss_side_progress >= 1.0f) {
-                orch->boss_side_progress = 1.0f;
-                orch->boss_moving_right = false;
-            }
-        } else {
-            orch->boss_side_progress -= move_speed * delta_time;
-            if (orch->boss_side_progress <= 0.0f) {
-                orch->boss_side_progress = 0.0f;
-                orch->boss_moving_right = true;
-            }
+        if (boss->system.flash_timer > 0.0f) {
+            boss->system.flash_timer -= delta_time;
+            if (boss->system.flash_timer < 0.0f) boss->system.flash_timer = 0.0f;
         }
-        boss->position.v[0] = (orch->boss_side_progress - 0.5f) * 2.0f * move_range;
     }
     
-    // Add sine wave vertical movement
-    orch->boss_spin_timer += delta_time;
-    boss->position.v[1] = -100.0f + sinf(orch->boss_spin_timer * 1.5f) * 30.0f;
-    
-    // Phase-specific behavior
-    if (boss->movement_phase == 1) {
-        // Phase 1: Move animation, SlashLeft/SlashRight shoot fan towards player
-        animation_system_update(&orch->boss_anim, delta_time);
-        
-        boss->shoot_timer += delta_time;
-        if (boss->shoot_timer >= 2.0f) {
-            boss->shoot_timer = 0.0f;
-            
-            // Play slash animation based on side position
-            if (orch->boss_side_progress < 0.5f) {
-                animation_system_play(&orch->boss_anim, "SlashLeft", false);
-            } else {
-                animation_system_play(&orch->boss_anim, "SlashRight", false);
-            }
-            
-            // Shoot fan of 4 projectiles angled towards player
-            float base_angle = 0.0f;  // Forward direction
-            float spread = 0.3f;  // Spread angle in radians
-            
-            T3DVec3 spawn_pos = {{boss->position.v[0], boss->position.v[1] + 100.0f, boss->position.v[2]}};
-            
-            for (int i = 0; i < 4; i++) {
-                float angle = base_angle + (i - 1.5f) * spread;
-                T3DVec3 dir = {{sinf(angle), 0.0f, cosf(angle)}};
-                t3d_vec3_norm(&dir);
-                projectile_system_spawn(ps, spawn_pos, dir, PROJECTILE_ENEMY);
+    // Check defeat
+    if (!enemy_system_is_active(&boss->system)) {
+        for (int j = boss->collision_start_index; j < boss->collision_start_index + boss->collision_count; j++) {
+            if (j < orch->collision_system->count) {
+                orch->collision_system->boxes[j].active = false;
             }
         }
-        
-        // Transition to barrage phase
-        orch->boss_barrage_cooldown -= delta_time;
-        if (orch->boss_barrage_cooldown <= 0.0f) {
-            boss->movement_phase = 2;
-            orch->boss_barrage_cooldown = 0.0f;
-        }
-        
-    } else if (boss->movement_phase == 2) {
-        // Phase 2: Move side to side, occasionally do SlashBarage with stream
-        
-        orch->boss_barrage_cooldown += delta_time;
-        
-        if (orch->boss_barrage_cooldown < 3.0f) {
-            // Doing barrage attack
-            animation_system_update(&orch->boss_anim, delta_time);
-            
-            if (orch->boss_barrage_cooldown < 0.1f) {
-                // Start barrage - stop near current position
-                animation_system_play(&orch->boss_anim, "SlashBarage", false);
-            }
-            
-            // Stream of projectiles
-            boss->shoot_timer += delta_time;
-            if (boss->shoot_timer >= 0.15f) {
-                boss->shoot_timer = 0.0f;
-                T3DVec3 spawn_pos = {{boss->position.v[0], boss->position.v[1] + 100.0f, boss->position.v[2]}};
-                T3DVec3 dir = {{0.0f, 0.0f, 1.0f}};
-                projectile_system_spawn(ps, spawn_pos, dir, PROJECTILE_ENEMY);
-            }
-        } else if (orch->boss_barrage_cooldown < 6.0f) {
-            // Moving side to side between barrages
-            animation_system_update(&orch->boss_anim, delta_time);
-            
-            if (orch->boss_barrage_cooldown > 3.1f && orch->boss_barrage_cooldown < 3.2f) {
-                animation_system_play(&orch->boss_anim, "Move", true);
-            }
-        } else {
-            // Return to phase 1
-            boss->movement_phase = 1;
-            animation_system_play(&orch->boss_anim, "Move", true);
-            orch->boss_barrage_cooldown = 10.0f;
-            boss->shoot_timer = 0.0f;
+        boss->active = false;
+        orch->active_count--;
+        if (def->explosion_scale > 0.0f) {
+            explosion_system_spawn(&orch->explosions, boss->position, def->explosion_scale, 0.25f);
         }
-        
-    } else {
-        // Idle fallback
-        animation_system_update(&orch->boss_anim, delta_time);
+        return;
     }
     
-    // Update transform
-    float scale[3] = {1.0f, 1.0f, 1.0f};
-    float rotation[3] = {0.0f, 0.0f, 0.0f};
-    float position[3] = {boss->position.v[0], boss->position.v[1], boss->position.v[2]};
-    t3d_mat4fp_from_srt_euler(boss->matrix, scale, rotation, position);
+    boss_runtime_update(&orch->boss, &boss->position, &boss->velocity, delta_time, ps);
     
     // Update collision
     collision_system_update_boxes_by_range(orch->collision_system, 
                                           boss->collision_start_index, 
                                           boss->collision_count, 
-                                          boss->matrix);
+                                          &boss->position);
+}
+
+bool enemy_orchestrator_is_boss(EnemyOrchestrator* orch, int index) {
+    return orch->boss.loaded && index == orch->boss_slot;
 }
 
 T3DModel* enemy_orchestrator_get_boss_model(EnemyOrchestrator* orch) {
-    return orch->boss_model;
+    return orch->boss.model;
 }
 
 T3DSkeleton* enemy_orchestrator_get_boss_skeleton(EnemyOrchestrator* orch) {
-    return orch->boss_skeleton;
+    return orch->boss.skeleton;
 }
 
-// Level 5 Boss Functions
-
-void enemy_orchestrator_init_level5_boss(EnemyOrchestrator* orch, CollisionSystem* collision_system) {
-    orch->enemy_model = NULL;
-    orch->bomber_model = NULL;
-    orch->bomber_skeleton = NULL;
-    orch->bomber_anim_system = NULL;
-    orch->collision_system = collision_system;
-    orch->elapsed_time = 0.0f;
-    orch->last_spawn_time = 0.0f;
-    orch->active_count = 0;
-    orch->wave_count = 0;
-    
-    // Load explosion model
-    orch->explosion_model = t3d_model_load("rom:/explosion.t3dm");
-    
-    // Allocate explosion matrices
-    orch->explosion_matrices = malloc_uncached(sizeof(T3DMat4FP*) * MAX_ENEMIES);
-    for (int i = 0; i < MAX_ENEMIES; i++) {
-        orch->explosion_matrices[i] = malloc_uncached(sizeof(T3DMat4FP));
-        t3d_mat4fp_identity(orch->explosion_matrices[i]);
-    }
-    
-    // Initialize all enemy slots
-    for (int i = 0; i < MAX_ENEMIES; i++) {
-        orch->enemies[i].matrix = malloc_uncached(sizeof(T3DMat4FP));
-        t3d_mat4fp_identity(orch->enemies[i].matrix);
-        orch->enemies[i].active = false;
-        orch->enemies[i].collision_start_index = -1;
-        orch->enemies[i].collision_count = 0;
-        orch->enemies[i].movement_phase = 0;
-        orch->enemies[i].phase_timer = 0.0f;
-        orch->enemies[i].shoot_timer = 0.0f;
-        orch->enemies[i].has_explosion = false;
-        orch->enemies[i].explosion_timer = 0.0f;
-    }
-    
-    // Load Level 5 boss model
-    orch->level5_boss_model = t3d_model_load("rom:/enemy4.t3dm");
-    if (!orch->level5_boss_model) {
-        debugf("ERROR: Failed to load enemy4.t3dm for Level 5 boss\n");
-        return;
-    }
-    
-    // Initialize boss skeleton and animation
-    const T3DChunkSkeleton* skelChunk = t3d_model_get_skeleton(orch->level5_boss_model);
-    if (skelChunk) {
-        orch->level5_boss_skeleton = malloc_uncached(sizeof(T3DSkeleton));
-        *orch->level5_boss_skeleton = t3d_skeleton_create(orch->level5_boss_model);
-        animation_system_init(&orch->level5_boss_anim, orch->level5_boss_model, orch->level5_boss_skeleton);
-        animation_system_play(&orch->level5_boss_anim, "Move", true);
-    }
-    
-    // Initialize Level 5 boss state
-    orch->level5_boss_sine_timer = 0.0f;
-    orch->level5_boss_phase = 0;  // Start with Phase 0 (MachineGun)
-    orch->level5_boss_attack_timer = 0.0f;
-    orch->level5_boss_curve_offset = 0.0f;
-    orch->level5_boss_curve_right = true;
-    orch->level5_boss_cannon_shots = 0;
-    
-    // Spawn boss in slot 0
-    EnemyInstance* boss = &orch->enemies[0];
-    boss->position = (T3DVec3){{0.0f, -100.0f, -300.0f}};
-    boss->velocity = (T3DVec3){{0.0f, 0.0f, 0.0f}};
-    
-    // Setup transform with scale 1.2
-    float scale[3] = {1.2f, 1.2f, 1.2f};
-    float rotation[3] = {0.0f, 0.0f, 0.0f};
-    float position[3] = {0.0f, -100.0f, -300.0f};
-    t3d_mat4fp_from_srt_euler(boss->matrix, scale, rotation, position);
-    
-    // Extract collision
-    int collision_before = collision_system->count;
-    collision_system_extract_from_model(collision_system, orch->level5_boss_model, "ENEMY_", COLLISION_ENEMY);
-    boss->collision_start_index = collision_before;
-    boss->collision_count = collision_system->count - collision_before;
-    collision_system_update_boxes_by_range(collision_system, boss->collision_start_index, boss->collision_count, boss->matrix);
-    
-    // Initialize with health from mesh name
-    int boss_health = collision_system_get_enemy_health(collision_system);
-    enemy_system_init(&boss->system, boss_health);
-    boss->active = true;
-    boss->show_hit = false;
-    boss->hit_timer = 0.0f;
-    boss->shoot_timer = 0.0f;
-    boss->movement_phase = 0;
-    boss->phase_timer = 0.0f;
-    
-    orch->active_count = 1;
-    debugf("Level 5 Boss initialized: %d HP\n", boss_health);
+AnimationSystem* enemy_orchestrator_get_boss_anim(EnemyOrchestrator* orch) {
+    return &orch->boss.anim;
 }
 
-void enemy_orchestrator_update_level5_boss(EnemyOrchestrator* orch, float delta_time, void* projectile_system_ptr) {
-    if (delta_time <= 0.0f || delta_time > 1.0f) delta_time = 0.016f;
-    
-    ProjectileSystem* ps = (ProjectileSystem*)projectile_system_ptr;
-    orch->elapsed_time += delta_time;
-    
-    if (!orch->level5_boss_model || !orch->level5_boss_skeleton) return;
-    
-    EnemyInstance* boss = &orch->enemies[0];
-    if (!boss->active) return;
-    
-    // Update animation system once per frame
-    animation_system_update(&orch->level5_boss_anim, delta_time);
-    
-    // Update health system
-    enemy_system_update(&boss->system, delta_time, &boss->show_hit, &boss->hit_timer, 
-                       orch->collision_system, boss->system.last_damage_taken);
-    
-    // Check defeat
-    if (!boss->system.active && !boss->has_explosion) {
-        boss->active = false;
-        boss->has_explosion = true;
-        boss->explosion_timer = 0.25f;
-        boss->explosion_position = boss->position;
-        orch->active_count = 0;
-        
-        float exp_scale[3] = {4.0f, 4.0f, 4.0f};
-        float exp_rotation[3] = {0.0f, 0.0f, 0.0f};
-        float exp_position[3] = {boss->explosion_position.v[0], boss->explosion_position.v[1], boss->explosion_position.v[2]};
-        t3d_mat4fp_from_srt_euler(orch->explosion_matrices[0], exp_scale, exp_rotation, exp_position);
-        return;
-    }
-    
-    // Update explosion
-    if (boss->has_explosion) {
-        boss->explosion_timer -= delta_time;
-        if (boss->explosion_timer <= 0.0f) {
-            boss->has_explosion = false;
-        }
-        return;
-    }
-    
-    // Sine wave vertical movement
-    orch->level5_boss_sine_timer += delta_time;
-    boss->position.v[1] = -100.0f + sinf(orch->level5_boss_sine_timer * 1.2f) * 40.0f;
-    
-    // Phase management
-    orch->level5_boss_attack_timer += delta_time;
-    
-    if (orch->level5_boss_phase == 0) {
-        // Phase 0: MachineGun attack with curving projectiles
-        
-        if (orch->level5_boss_attack_timer < 0.1f) {
-            // Just entered phase - play MachineGun animation
-            animation_system_play(&orch->level5_boss_anim, "MachineGun", true);
-            orch->level5_boss_curve_offset = 0.0f;
-            orch->level5_boss_curve_right = true;
-        }
-        
-        // Shoot tightly packed projectiles that curve
-        boss->shoot_timer += delta_time;
-        if (boss->shoot_timer >= 0.25f) {
-            boss->shoot_timer = 0.0f;
-            
-            // Update curve direction
-            if (orch->level5_boss_curve_right) {
-                orch->level5_boss_curve_offset += 0.08f;
-                if (orch->level5_boss_curve_offset >= 0.6f) {
-                    orch->level5_boss_curve_right = false;
-                }
-            } else {
-                orch->level5_boss_curve_offset -= 0.08f;
-                if (orch->level5_boss_curve_offset <= -0.6f) {
-                    orch->level5_boss_curve_right = true;
-                }
-            }
-            
-            // Spawn projectile with curve
-            T3DVec3 spawn_pos = {{boss->position.v[0], boss->position.v[1] + 100.0f, boss->position.v[2]}};
-            float angle = orch->level5_boss_curve_offset;
-            T3DVec3 dir = {{sinf(angle), 0.0f, cosf(angle)}};
-            t3d_vec3_norm(&dir);
-            projectile_system_spawn(ps, spawn_pos, dir, PROJECTILE_ENEMY);
-        }
-        
-        // Transition to Cannon phase after 8 seconds
-        if (orch->level5_boss_attack_timer >= 8.0f) {
-            orch->level5_boss_phase = 1;
-            orch->level5_boss_attack_timer = 0.0f;
-            orch->level5_boss_cannon_shots = 0;
-            animation_system_play(&orch->level5_boss_anim, "Cannon", false);
-        }
-        
-    } else if (orch->level5_boss_phase == 1) {
-        // Phase 1: Cannon attack - fan of 3 projectiles twice
-        
-        if (orch->level5_boss_attack_timer < 0.1f) {
-            // Just entered phase - play Cannon animation
-            animation_system_play(&orch->level5_boss_anim, "Cannon", false);
-        }
-        
-        // Shoot fan of 3 projectiles at specific intervals
-        if (orch->level5_boss_cannon_shots == 0 && orch->level5_boss_attack_timer >= 0.5f) {
-            // First shot
-            orch->level5_boss_cannon_shots = 1;
-            
-            T3DVec3 spawn_pos = {{boss->position.v[0], boss->position.v[1] + 100.0f, boss->position.v[2]}};
-            
-            // Fan of 3 projectiles
-            for (int i = 0; i < 3; i++) {
-                float angle = (i - 1) * 0.4f;  // -0.4, 0, 0.4 radians
-                T3DVec3 dir = {{sinf(angle), 0.0f, cosf(angle)}};
-                t3d_vec3_norm(&dir);
-                projectile_system_spawn(ps, spawn_pos, dir, PROJECTILE_ENEMY);
-            }
-            
-        } else if (orch->level5_boss_cannon_shots == 1 && orch->level5_boss_attack_timer >= 1.5f) {
-            // Second shot
-            orch->level5_boss_cannon_shots = 2;
-            
-            T3DVec3 spawn_pos = {{boss->position.v[0], boss->position.v[1] + 100.0f, boss->position.v[2]}};
-            
-            // Fan of 3 projectiles
-            for (int i = 0; i < 3; i++) {
-                float angle = (i - 1) * 0.4f;  // -0.4, 0, 0.4 radians
-                T3DVec3 dir = {{sinf(angle), 0.0f, cosf(angle)}};
-                t3d_vec3_norm(&dir);
-                projectile_system_spawn(ps, spawn_pos, dir, PROJECTILE_ENEMY);
-            }
-        }
-        
-        // Return to MachineGun phase after 3 seconds
-        if (orch->level5_boss_attack_timer >= 3.0f) {
-            orch->level5_boss_phase = 0;
-            orch->level5_boss_attack_timer = 0.0f;
-            animation_system_play(&orch->level5_boss_anim, "Move", true);
-        }
-    }
-    
-    // Update transform
-    float scale[3] = {1.2f, 1.2f, 1.2f};
-    float rotation[3] = {0.0f, 0.0f, 0.0f};
-    float position[3] = {boss->position.v[0], boss->position.v[1], boss->position.v[2]};
-    t3d_mat4fp_from_srt_euler(boss->matrix, scale, rotation, position);
+/**
+ * Hand the boss animation to a scheduler at the boss's reduced rate
+ * It is skipped while the boss is off-screen or defeated
+ */
+void enemy_orchestrator_schedule_boss(EnemyOrchestrator* orch, AnimScheduler* sched) {
+    if (!orch->boss.loaded || !orch->boss.skeleton || orch->boss_slot < 0) return;
     
-    // Update collision
-    collision_system_update_boxes_by_range(orch->collision_system, 
-                                          boss->collision_start_index, 
-                                          boss->collision_count, 
-                                          boss->matrix);
-}
-
-T3DModel* enemy_orchestrator_get_level5_boss_model(EnemyOrchestrator* orch) {
-    return orch->level5_boss_model;
-}
-
-T3DSkeleton* enemy_orchestrator_get_level5_boss_skeleton(EnemyOrchestrator* orch) {
-    return orch->level5_boss_skeleton;
+    const BossDef* def = orch->boss.def;
+    EnemyInstance* boss = &orch->enemies[orch->boss_slot];
+    anim_scheduler_add(sched, &orch->boss.anim, &boss->position, &boss->active,
+                       def->bounds_radius * def->scale, def->anim_divisor);
 }
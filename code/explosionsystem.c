@@ -0,0 +1,116 @@
+/**
+ * @file explosionsystem.c
+ * @brief Pooled explosion effects with a dense live list
+ */
+
+#include "explosionsystem.h"
+#include "matrixring.h"
+#include "assetcache.h"
+#include <string.h>
+
+void explosion_system_init(ExplosionSystem* es) {
+    if (!es) return;
+    
+    memset(es, 0, sizeof(ExplosionSystem));
+    
+    es->model = asset_cache_get_model(EXPLOSION_MODEL_PATH);
+    if (!es->model) {
+        debugf("WARNING: Failed to load enemy explosion model\n");
+    }
+    
+    explosion_system_clear(es);
+    es->initialized = true;
+}
+
+void explosion_system_clear(ExplosionSystem* es) {
+    if (!es) return;
+    
+    es->live_count = 0;
+    es->free_count = MAX_EXPLOSIONS;
+    
+    // Hand out low slots first
+    for (int i = 0; i < MAX_EXPLOSIONS; i++) {
+        es->free_slots[i] = MAX_EXPLOSIONS - 1 - i;
+        es->explosions[i].timer = 0.0f;
+    }
+}
+
+bool explosion_system_spawn(ExplosionSystem* es, T3DVec3 position, float scale, float duration) {
+    if (!es || !es->initialized) return false;
+    
+    if (es->free_count == 0) {
+        debugf("WARNING: No explosion slots available!\n");
+        return false;
+    }
+    
+    int slot = es->free_slots[--es->free_count];
+    Explosion* exp = &es->explosions[slot];
+    exp->position = position;
+    exp->scale = scale;
+    exp->timer = duration;
+    
+    es->live[es->live_count++] = slot;
+    
+    debugf("*** EXPLOSION %d CREATED at (%.1f, %.1f, %.1f) timer=%.2f\n",
+           slot, position.v[0], position.v[1], position.v[2], duration);
+    return true;
+}
+
+void explosion_system_update(ExplosionSystem* es, float delta_time) {
+    if (!es || !es->initialized) return;
+    
+    // Only live effects are visited; finished ones are swap-removed
+    int i = 0;
+    while (i < es->live_count) {
+        int slot = es->live[i];
+        Explosion* exp = &es->explosions[slot];
+        exp->timer -= delta_time;
+        
+        if (exp->timer <= 0.0f) {
+            es->live[i] = es->live[--es->live_count];
+            es->free_slots[es->free_count++] = slot;
+        } else {
+            i++;
+        }
+    }
+}
+
+void explosion_system_render(ExplosionSystem* es) {
+    if (!es || !es->initialized || !es->model) return;
+    
+    float rotation[3] = {0.0f, 0.0f, 0.0f};
+    for (int i = 0; i < es->live_count; i++) {
+        const Explosion* exp = &es->explosions[es->live[i]];
+        float scale[3] = {exp->scale, exp->scale, exp->scale};
+        float position[3] = {exp->position.v[0], exp->position.v[1], exp->position.v[2]};
+        t3d_matrix_push(matrix_ring_srt_euler(scale, rotation, position));
+        
+        T3DModelDrawConf explosionDrawConf = {
+            .userData = NULL,
+            .tileCb = NULL,
+            .filterCb = NULL,
+            .dynTextureCb = NULL,
+            .matrices = NULL
+        };
+        
+        t3d_model_draw_custom(es->model, explosionDrawConf);
+        t3d_matrix_pop(1);
+    }
+}
+
+int explosion_system_get_live_count(const ExplosionSystem* es) {
+    return es ? es->live_count : 0;
+}
+
+void explosion_system_cleanup(ExplosionSystem* es) {
+    if (!es) return;
+    
+    if (es->model) {
+        asset_cache_release(es->model);
+        es->model = NULL;
+    }
+    
+    es->live_count = 0;
+    es->free_count = 0;
+    es->initialized = false;
+}
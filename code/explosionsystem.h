@@ -0,0 +1,50 @@
+#ifndef EXPLOSIONSYSTEM_H
+#define EXPLOSIONSYSTEM_H
+
+#include <libdragon.h>
+#include <t3d/t3d.h>
+#include <t3d/t3dmodel.h>
+
+#define MAX_EXPLOSIONS 16
+#define EXPLOSION_MODEL_PATH "rom:/explosion.t3dm"
+
+// Single explosion effect
+typedef struct {
+    T3DVec3 position;
+    float scale;
+    float timer;                // Remaining display time
+} Explosion;
+
+// Explosion effect pool, independent of enemy slots
+typedef struct {
+    Explosion explosions[MAX_EXPLOSIONS];
+    int live[MAX_EXPLOSIONS];   // Dense list of live slot indices
+    int live_count;
+    int free_slots[MAX_EXPLOSIONS];  // Stack of free slot indices
+    int free_count;
+    T3DModel* model;            // Shared explosion model
+    bool initialized;
+} ExplosionSystem;
+
+// Initialize the pool and load the explosion model
+void explosion_system_init(ExplosionSystem* es);
+
+// Spawn an explosion at a position (returns false if the pool is full)
+bool explosion_system_spawn(ExplosionSystem* es, T3DVec3 position, float scale, float duration);
+
+// Advance live explosions and retire finished ones
+void explosion_system_update(ExplosionSystem* es, float delta_time);
+
+// Draw all live explosions (matrices come from the per-frame matrix ring)
+void explosion_system_render(ExplosionSystem* es);
+
+// Remove all live explosions
+void explosion_system_clear(ExplosionSystem* es);
+
+// Get number of live explosions
+int explosion_system_get_live_count(const ExplosionSystem* es);
+
+// Cleanup
+void explosion_system_cleanup(ExplosionSystem* es);
+
+#endif // EXPLOSIONSYSTEM_H
@@ -0,0 +1,121 @@
+/**
+ * @file framepipeline.c
+ * @brief Pipelined main loop timing: CPU simulation overlapping RSP/RDP rendering
+ */
+
+#include "framepipeline.h"
+#include "frameprofiler.h"
+
+static FramePipelineMode pipeline_mode = FRAME_MODE_PIPELINED;
+static int buffer_count = FRAME_PIPELINE_MIN_BUFFERS;
+
+static rspq_syncpoint_t last_frame_sync;
+static bool last_frame_sync_valid = false;
+
+static FrameTimings current;
+static FrameTimings last;
+static uint64_t update_start_us;
+static uint64_t render_start_us;
+
+#ifdef DEBUG
+// Running totals for the periodic report
+static uint64_t total_update_us;
+static uint64_t total_render_us;
+static uint64_t total_wait_us;
+static uint64_t total_overlap_us;
+static int total_busy_frames;
+static int total_frames;
+#endif
+
+void frame_pipeline_init(FramePipelineMode mode) {
+    pipeline_mode = mode;
+    
+    // A third 320x240x16 buffer (150 KB) lets the CPU run a full frame ahead; only spend it with the Expansion Pak
+    buffer_count = is_memory_expanded() ? FRAME_PIPELINE_MAX_BUFFERS : FRAME_PIPELINE_MIN_BUFFERS;
+    display_init(RESOLUTION_320x240, DEPTH_16_BPP, buffer_count, GAMMA_NONE, FILTERS_RESAMPLE_ANTIALIAS);
+    
+    last_frame_sync_valid = false;
+    debugf("Frame pipeline: %s, %d framebuffers\n",
+           mode == FRAME_MODE_PIPELINED ? "pipelined" : "serial", buffer_count);
+}
+
+int frame_pipeline_get_buffer_count(void) {
+    return buffer_count;
+}
+
+void frame_pipeline_begin_update(void) {
+    current = (FrameTimings){0};
+    current.gpu_busy_at_update_start = last_frame_sync_valid && !rspq_syncpoint_check(last_frame_sync);
+    update_start_us = get_ticks_us();
+}
+
+void frame_pipeline_end_update(void) {
+    uint64_t now = get_ticks_us();
+    current.update_us = (uint32_t)(now - update_start_us);
+    
+    // Still busy now means the whole simulation ran alongside the previous frame
+    if (last_frame_sync_valid && !rspq_syncpoint_check(last_frame_sync)) {
+        current.overlap_us = current.update_us;
+    }
+}
+
+void frame_pipeline_begin_render(void) {
+    render_start_us = get_ticks_us();
+}
+
+surface_t* frame_pipeline_get_display(void) {
+    uint64_t start = get_ticks_us();
+    surface_t* disp = display_get();
+    current.display_wait_us += (uint32_t)(get_ticks_us() - start);
+    return disp;
+}
+
+void frame_pipeline_show(void) {
+    frame_profiler_draw();
+    rdpq_detach_show();
+}
+
+bool frame_pipeline_gpu_idle(void) {
+    return !last_frame_sync_valid || rspq_syncpoint_check(last_frame_sync);
+}
+
+void frame_pipeline_end_render(void) {
+    uint64_t now = get_ticks_us();
+    uint32_t render_total = (uint32_t)(now - render_start_us);
+    current.render_us = render_total > current.display_wait_us ? render_total - current.display_wait_us : 0;
+    
+    // Kick the command list now so the RSP/RDP work while the CPU simulates the next tick
+    last_frame_sync = rspq_syncpoint_new();
+    last_frame_sync_valid = true;
+    rspq_flush();
+    
+    if (pipeline_mode == FRAME_MODE_SERIAL) {
+        rspq_wait();
+    }
+    
+    last = current;
+    
+#ifdef DEBUG
+    total_update_us += current.update_us;
+    total_render_us += current.render_us;
+    total_wait_us += current.display_wait_us;
+    total_overlap_us += current.overlap_us;
+    total_busy_frames += current.gpu_busy_at_update_start ? 1 : 0;
+    total_frames++;
+    
+    if (total_frames >= FRAME_PIPELINE_REPORT_FRAMES) {
+        float frames = (float)total_frames;
+        float overlap_pct = total_update_us ? 100.0f * (float)total_overlap_us / (float)total_update_us : 0.0f;
+        debugf("Frame pipeline (%d frames): update %.2f ms, render %.2f ms, display wait %.2f ms, "
+               "overlap >= %.0f%% of update, GPU busy at update start %d%%\n",
+               total_frames, total_update_us / frames / 1000.0f, total_render_us / frames / 1000.0f,
+               total_wait_us / frames / 1000.0f, overlap_pct, total_busy_frames * 100 / total_frames);
+        total_update_us = total_render_us = total_wait_us = total_overlap_us = 0;
+        total_busy_frames = total_frames = 0;
+    }
+#endif
+}
+
+const FrameTimings* frame_pipeline_get_last(void) {
+    return &last;
+}
@@ -0,0 +1,53 @@
+#ifndef FRAMEPIPELINE_H
+#define FRAMEPIPELINE_H
+
+#include <libdragon.h>
+#include <stdint.h>
+
+#define FRAME_PIPELINE_MAX_BUFFERS 3    // Triple buffering with the Expansion Pak
+#define FRAME_PIPELINE_MIN_BUFFERS 2
+#define FRAME_PIPELINE_DEPTH 3          // Frames that may be in flight at once (size of per-frame buffers)
+#define FRAME_PIPELINE_REPORT_FRAMES 120
+
+// How the CPU and the RSP/RDP share a frame
+typedef enum {
+    FRAME_MODE_PIPELINED,   // Simulate the next tick while the previous command list executes
+    FRAME_MODE_SERIAL       // Wait for the RSP/RDP after every frame (baseline for comparisons)
+} FramePipelineMode;
+
+// Timings for one frame, in microseconds
+typedef struct {
+    uint32_t update_us;         // CPU simulation time
+    uint32_t render_us;         // CPU time building the command list, without display_wait_us
+    uint32_t display_wait_us;   // Time blocked waiting for a free framebuffer
+    uint32_t overlap_us;        // Simulation time that ran while the previous frame was still executing (lower bound)
+    bool gpu_busy_at_update_start;
+} FrameTimings;
+
+// Initialize the display with as many framebuffers as memory allows
+void frame_pipeline_init(FramePipelineMode mode);
+
+// Number of framebuffers in use
+int frame_pipeline_get_buffer_count(void);
+
+// Mark the simulation part of the frame
+void frame_pipeline_begin_update(void);
+void frame_pipeline_end_update(void);
+
+// Mark the render part of the frame; end records a syncpoint for the next frame's overlap check
+void frame_pipeline_begin_render(void);
+void frame_pipeline_end_render(void);
+
+// Get the next framebuffer, timing how long the CPU waited for it (use instead of display_get)
+surface_t* frame_pipeline_get_display(void);
+
+// Draw the profiler overlay and show the attached framebuffer (use instead of rdpq_detach_show)
+void frame_pipeline_show(void);
+
+// True once the RSP/RDP have finished the last submitted frame
+bool frame_pipeline_gpu_idle(void);
+
+// Timings of the last completed frame
+const FrameTimings* frame_pipeline_get_last(void);
+
+#endif // FRAMEPIPELINE_H
@@ -0,0 +1,165 @@
+/**
+ * @file frameprofiler.c
+ * @brief Per-subsystem CPU timings and RDP busy counters shown as an overlay
+ */
+
+#include "frameprofiler.h"
+
+#ifdef DEBUG
+
+#include "framepipeline.h"
+
+// RDP command unit registers (DPC); the counters run at the RCP clock and are 24 bits wide
+#define DPC_STATUS      ((volatile uint32_t*)0xA410000C)
+#define DPC_CLOCK       ((volatile uint32_t*)0xA4100010)
+#define DPC_BUFBUSY     ((volatile uint32_t*)0xA4100014)
+#define DPC_PIPEBUSY    ((volatile uint32_t*)0xA4100018)
+#define DPC_CLR_COUNTERS (0x40 | 0x80 | 0x100 | 0x200)    // TMEM, pipe, command and clock counters
+#define DPC_COUNTER_MASK 0xFFFFFF
+#define RCP_CYCLES_TO_US(c) ((c) * 2 / 125)                 // 62.5 MHz
+
+#define FRAME_BUDGET_US 16667
+#define OVERLAY_X 8
+#define OVERLAY_Y 16
+#define OVERLAY_LINE 10
+#define OVERLAY_BAR_X 200
+#define OVERLAY_BAR_WIDTH 100               // Pixels for a full 60 Hz frame
+
+typedef struct {
+    uint32_t section_us[PROF_COUNT];
+    uint32_t update_us;
+    uint32_t render_us;
+    uint32_t rdp_busy_us;       // RDP had commands to process
+    uint32_t rdp_pipe_us;       // RDP pipeline was drawing
+    uint32_t rdp_clock_us;      // Time covered by the two counters above
+    uint32_t gpu_us;            // Submit to completion of the previous command list (upper bound, polled)
+} FrameSample;
+
+static const char* section_names[PROF_COUNT] = {
+    "joypad", "anim", "enemies", "projectiles", "collision",
+    "matrices", "audio", "pass world", "pass actors", "pass hud"
+};
+
+static FrameSample profiler_ring[FRAME_PROFILER_HISTORY];
+static int profiler_frames = 0;             // Frames recorded (may exceed the ring)
+static uint32_t section_ticks[PROF_COUNT];
+static FrameSample current;
+static bool overlay_visible = false;
+
+static uint32_t submit_ticks;
+static bool gpu_pending = false;
+
+// Catch the moment the last command list finishes (checked at every timer, so the latency is an upper bound)
+static void poll_gpu(void) {
+    if (gpu_pending && frame_pipeline_gpu_idle()) {
+        current.gpu_us = TICKS_TO_US(TICKS_DISTANCE(submit_ticks, TICKS_READ()));
+        gpu_pending = false;
+    }
+}
+
+void frame_profiler_begin_frame(void) {
+    for (int i = 0; i < PROF_COUNT; i++) section_ticks[i] = 0;
+    current = (FrameSample){0};
+    poll_gpu();
+}
+
+void frame_profiler_add(ProfSection section, uint32_t start_ticks) {
+    section_ticks[section] += TICKS_DISTANCE(start_ticks, TICKS_READ());
+    poll_gpu();
+}
+
+void frame_profiler_end_frame(void) {
+    for (int i = 0; i < PROF_COUNT; i++) {
+        current.section_us[i] = TICKS_TO_US(section_ticks[i]);
+    }
+    
+    const FrameTimings* timings = frame_pipeline_get_last();
+    current.update_us = timings->update_us;
+    current.render_us = timings->render_us;
+    
+    // Never finished within a frame: count the whole interval as busy
+    if (gpu_pending) {
+        current.gpu_us = TICKS_TO_US(TICKS_DISTANCE(submit_ticks, TICKS_READ()));
+    }
+    
+    // Read and restart the RDP counters
+    current.rdp_clock_us = RCP_CYCLES_TO_US(*DPC_CLOCK & DPC_COUNTER_MASK);
+    current.rdp_busy_us = RCP_CYCLES_TO_US(*DPC_BUFBUSY & DPC_COUNTER_MASK);
+    current.rdp_pipe_us = RCP_CYCLES_TO_US(*DPC_PIPEBUSY & DPC_COUNTER_MASK);
+    *DPC_STATUS = DPC_CLR_COUNTERS;
+    
+    profiler_ring[profiler_frames % FRAME_PROFILER_HISTORY] = current;
+    profiler_frames++;
+    
+    // frame_pipeline_end_render has just submitted this frame's command list
+    submit_ticks = TICKS_READ();
+    gpu_pending = true;
+}
+
+void frame_profiler_poll_input(void) {
+    joypad_buttons_t pressed = joypad_get_buttons_pressed(JOYPAD_PORT_1);
+    joypad_buttons_t held = joypad_get_buttons_held(JOYPAD_PORT_1);
+    
+    if ((pressed.l && held.r) || (pressed.r && held.l)) {
+        overlay_visible = !overlay_visible;
+    }
+}
+
+static void draw_line(int line, const char* label, uint32_t avg_us, uint32_t max_us) {
+    int y = OVERLAY_Y + line * OVERLAY_LINE;
+    rdpq_text_printf(NULL, 1, OVERLAY_X, y, "%-11s %5.2f %5.2f", label, avg_us / 1000.0f, max_us / 1000.0f);
+}
+
+static void draw_bar(int line, uint32_t avg_us, color_t color) {
+    int width = (int)(avg_us * OVERLAY_BAR_WIDTH / FRAME_BUDGET_US);
+    if (width > OVERLAY_BAR_WIDTH) width = OVERLAY_BAR_WIDTH;
+    if (width < 1) return;
+    
+    int y = OVERLAY_Y + line * OVERLAY_LINE;
+    rdpq_set_mode_fill(color);
+    rdpq_fill_rectangle(OVERLAY_BAR_X, y - 7, OVERLAY_BAR_X + width, y - 1);
+}
+
+void frame_profiler_draw(void) {
+    if (!overlay_visible || profiler_frames == 0) return;
+    
+    int kept = profiler_frames < FRAME_PROFILER_HISTORY ? profiler_frames : FRAME_PROFILER_HISTORY;
+    
+    // Average and worst frame per field over the ring
+    enum { FIELD_COUNT = sizeof(FrameSample) / sizeof(uint32_t) };
+    uint32_t avg[FIELD_COUNT];
+    uint32_t max[FIELD_COUNT];
+    for (int f = 0; f < FIELD_COUNT; f++) {
+        uint32_t total = 0;
+        max[f] = 0;
+        for (int i = 0; i < kept; i++) {
+            uint32_t value = ((const uint32_t*)&profiler_ring[i])[f];
+            total += value;
+            if (value > max[f]) max[f] = value;
+        }
+        avg[f] = total / kept;
+    }
+    const FrameSample* a = (const FrameSample*)avg;
+    const FrameSample* m = (const FrameSample*)max;
+    
+    // Bars first (fill mode), then the text on top
+    for (int i = 0; i < PROF_COUNT; i++) {
+        draw_bar(2 + i, a->section_us[i], RGBA32(0x40, 0xC0, 0x40, 0xFF));
+    }
+    draw_bar(2 + PROF_COUNT, a->rdp_busy_us, RGBA32(0xE0, 0x80, 0x20, 0xFF));
+    draw_bar(3 + PROF_COUNT, a->gpu_us, RGBA32(0xE0, 0x40, 0x40, 0xFF));
+    
+    rdpq_set_mode_standard();
+    rdpq_text_printf(NULL, 1, OVERLAY_X, OVERLAY_Y, "%d frames   avg ms  max ms", kept);
+    draw_line(1, "cpu upd+ren", a->update_us + a->render_us, m->update_us + m->render_us);
+    for (int i = 0; i < PROF_COUNT; i++) {
+        draw_line(2 + i, section_names[i], a->section_us[i], m->section_us[i]);
+    }
+    draw_line(2 + PROF_COUNT, "rdp busy", a->rdp_busy_us, m->rdp_busy_us);
+    draw_line(3 + PROF_COUNT, "rsp+rdp", a->gpu_us, m->gpu_us);
+    rdpq_text_printf(NULL, 1, OVERLAY_X, OVERLAY_Y + (4 + PROF_COUNT) * OVERLAY_LINE,
+                     "rdp pipe %d%% of %.1f ms", a->rdp_clock_us ? (int)(a->rdp_pipe_us * 100 / a->rdp_clock_us) : 0,
+                     a->rdp_clock_us / 1000.0f);
+}
+
+#endif // DEBUG
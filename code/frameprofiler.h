@@ -0,0 +1,70 @@
+#ifndef FRAMEPROFILER_H
+#define FRAMEPROFILER_H
+
+#include <libdragon.h>
+#include <stdint.h>
+
+#define FRAME_PROFILER_HISTORY 64       // Frames kept for the overlay averages (oldest overwritten)
+
+// Runtime frame profiler (DEBUG builds only)
+// Scoped timers add CPU time per subsystem into the current frame; at the end of
+// the frame the totals go into a ring buffer together with the RDP busy counters
+// and the time the RSP/RDP took to finish the previous command list.
+// Hold L and press R (or the reverse) to show the overlay. Render passes measure
+// CPU time spent building commands, and include the matrix building done inside them.
+// Without DEBUG every timer compiles to the bare statement and the rest to nothing.
+
+typedef enum {
+    PROF_JOYPAD,
+    PROF_ANIMATION,
+    PROF_ENEMIES,           // Enemy orchestrator update
+    PROF_PROJECTILES,
+    PROF_COLLISION,
+    PROF_MATRICES,
+    PROF_AUDIO,             // Mixer polling
+    PROF_PASS_WORLD,        // Clear, lights and background
+    PROF_PASS_ACTORS,       // Enemies, player, explosions and projectiles
+    PROF_PASS_HUD,
+    PROF_COUNT
+} ProfSection;
+
+#ifdef DEBUG
+
+// Frame bracket (begin before the simulation ticks, end after the command list is submitted)
+void frame_profiler_begin_frame(void);
+void frame_profiler_end_frame(void);
+
+// Add the ticks since start_ticks to a section of the current frame
+void frame_profiler_add(ProfSection section, uint32_t start_ticks);
+
+// Toggle the overlay from the controller (call after each joypad_poll)
+void frame_profiler_poll_input(void);
+
+// Draw the overlay into the attached framebuffer if it is shown
+void frame_profiler_draw(void);
+
+// Time a statement (assignments only, declarations would not outlive the block)
+#define PROF(section, ...) do { \
+    uint32_t prof_start_ = TICKS_READ(); \
+    __VA_ARGS__; \
+    frame_profiler_add(section, prof_start_); \
+} while (0)
+
+// Time a span of statements within one block
+#define PROF_BEGIN(section) uint32_t prof_start_##section = TICKS_READ()
+#define PROF_END(section) frame_profiler_add(section, prof_start_##section)
+
+#else
+
+static inline void frame_profiler_begin_frame(void) {}
+static inline void frame_profiler_end_frame(void) {}
+static inline void frame_profiler_poll_input(void) {}
+static inline void frame_profiler_draw(void) {}
+
+#define PROF(section, ...) do { __VA_ARGS__; } while (0)
+#define PROF_BEGIN(section) do {} while (0)
+#define PROF_END(section) do {} while (0)
+
+#endif // DEBUG
+
+#endif // FRAMEPROFILER_H
@@ -1,15 +1,27 @@
 #include "intro.h"
+#include "framepipeline.h"
 #include "scenes.h"
+#include "loadprofiler.h"
+#include "mempolicy.h"
+#include "assetcache.h"
+#include "preload.h"
+
+#define INTRO_MECHA_MODEL_PATH "rom:/mecha.t3dm"
+#define INTRO_TUNNEL_MODEL_PATH "rom:/tunnel.t3dm"
+
+void intro_queue_preload(void) {
+    preload_queue_add_model(INTRO_MECHA_MODEL_PATH);
+    preload_queue_add_model(INTRO_TUNNEL_MODEL_PATH);
+}
 
 void intro_init(SceneIntro* scene, rdpq_font_t* font) {
-    scene->last_update_time = 0.0f;
     scene->scene_time = 0.0f;
     
     // Set up camera viewport
     scene->viewport = t3d_viewport_create();
 
     // Load mecha model
-    scene->mecha_model = t3d_model_load("rom:/mecha.t3dm");
+    scene->mecha_model = asset_cache_get_model(INTRO_MECHA_MODEL_PATH);
     if (!scene->mecha_model) {
         debugf("WARNING: Failed to load mecha model\n");
     } else {
@@ -19,26 +31,33 @@ void intro_init(SceneIntro* scene, rdpq_font_t* font) {
     // Initialize skeleton for rigged model
     const T3DChunkSkeleton* skelChunk = t3d_model_get_skeleton(scene->mecha_model);
     if (skelChunk && scene->mecha_model) {
-        scene->skeleton = malloc_uncached(sizeof(T3DSkeleton));
-        *scene->skeleton = t3d_skeleton_create(scene->mecha_model);
+        scene->skeleton = mem_alloc_cpu(sizeof(T3DSkeleton));
+        LOAD_PROFILE("skeleton", INTRO_MECHA_MODEL_PATH, *scene->skeleton = t3d_skeleton_create_buffered(scene->mecha_model, FRAME_PIPELINE_DEPTH));
         debugf("Skeleton created successfully\n");
 
         // Initialize animation system
-        animation_system_init(&scene->anim_system, scene->mecha_model, scene->skeleton);
+        LOAD_PROFILE("anim", INTRO_MECHA_MODEL_PATH, animation_system_init(&scene->anim_system, scene->mecha_model, scene->skeleton));
         
-        // Start with idle animation
-        animation_system_play(&scene->anim_system, "Idle", true);
+        // Start with idle animation, from the baked table when available
+        LOAD_PROFILE("poses", "rom:/mecha.pose", scene->poses = baked_pose_set_load("rom:/mecha.pose", scene->skeleton));
+        int idle = baked_pose_set_find_clip(scene->poses, "Idle");
+        if (idle == ANIM_CLIP_NONE || !animation_system_play_baked(&scene->anim_system, scene->poses, idle, true)) {
+            animation_system_play(&scene->anim_system, "Idle", true);
+        }
     } else {
         debugf("No skeleton found in model\n");
         scene->skeleton = NULL;
     }
 
-    // Allocate model matrix
-    scene->modelMat = malloc_uncached(sizeof(T3DMat4FP));
-    t3d_mat4fp_identity(scene->modelMat);
+    // Allocate model matrix (the mecha pose is fixed, so it is written once here)
+    scene->modelMat = mem_alloc_rsp(sizeof(T3DMat4FP));
+    float scale[3] = {1.0f, 1.0f, 1.0f};
+    float rotation[3] = {0.0f, T3D_DEG_TO_RAD(35.0f), 0.0f};
+    float position[3] = {0.0f, 0.0f, 0.0f};
+    t3d_mat4fp_from_srt_euler(scene->modelMat, scale, rotation, position);
 
     // Load tunnel map
-    scene->tunnel_model = t3d_model_load("rom:/tunnel.t3dm");
+    scene->tunnel_model = asset_cache_get_model(INTRO_TUNNEL_MODEL_PATH);
     if (!scene->tunnel_model) {
         debugf("WARNING: Failed to load tunnel model\n");
     } else {
@@ -46,7 +65,7 @@ void intro_init(SceneIntro* scene, rdpq_font_t* font) {
     }
     
     // Allocate tunnel matrix
-    scene->tunnelMat = malloc_uncached(sizeof(T3DMat4FP));
+    scene->tunnelMat = mem_alloc_rsp(sizeof(T3DMat4FP));
     t3d_mat4fp_identity(scene->tunnelMat);
 
     // Use pre-loaded font
@@ -54,10 +73,10 @@ void intro_init(SceneIntro* scene, rdpq_font_t* font) {
     rdpq_text_register_font(1, scene->font);
 
     // Load logo sprite
-    scene->logo_sprite = sprite_load("rom:/starstrikelogo.sprite");
+    LOAD_PROFILE("sprite", "rom:/starstrikelogo.sprite", scene->logo_sprite = sprite_load("rom:/starstrikelogo.sprite"));
     
     // Load press start sprite
-    scene->press_start_sprite = sprite_load("rom:/pressstart.sprite");
+    LOAD_PROFILE("sprite", "rom:/pressstart.sprite", scene->press_start_sprite = sprite_load("rom:/pressstart.sprite"));
 
     // Set up lighting
     scene->colorAmbient[0] = 180;
@@ -74,7 +93,7 @@ void intro_init(SceneIntro* scene, rdpq_font_t* font) {
     t3d_vec3_norm(&scene->lightDirVec);
     
     // Load and start music
-    wav64_open(&scene->music, "rom:/Brilliance_Days.wav64");
+    LOAD_PROFILE("audio", "rom:/Brilliance_Days.wav64", wav64_open(&scene->music, "rom:/Brilliance_Days.wav64"));
     wav64_set_loop(&scene->music, true);
     mixer_ch_set_limits(0, 0, 48000, 0);
     wav64_play(&scene->music, 0);
@@ -83,21 +102,7 @@ void intro_init(SceneIntro* scene, rdpq_font_t* font) {
     debugf("Intro scene initialized\n");
 }
 
-int intro_update(SceneIntro* scene) {
-    // Calculate delta time
-    float current_time = (float)((double)get_ticks_us() / 1000000.0);
-    float delta_time;
-    if (scene->last_update_time == 0.0f) {
-        delta_time = 1.0f / 60.0f;
-    } else {
-        delta_time = current_time - scene->last_update_time;
-    }
-    scene->last_update_time = current_time;
-    
-    if (delta_time < 0.0f || delta_time > 0.5f) {
-        delta_time = 1.0f / 60.0f;
-    }
-
+int intro_update(SceneIntro* scene, float delta_time) {
     // Update scene timer
     scene->scene_time += delta_time;
 
@@ -117,13 +122,6 @@ int intro_update(SceneIntro* scene) {
 
     // Set up camera
     const T3DVec3 camPos = {{0, 125.0f, 100.0f}};
-    // Set model matrix
-    float scale[3] = {1.0f, 1.0f, 1.0f};
-    float rotation[3] = {0.0f, T3D_DEG_TO_RAD(35.0f), 0.0f};
-    float position[3] = {0.0f, 0.0f, 0.0f};
-
-    t3d_mat4fp_from_srt_euler(scene->modelMat, scale, rotation, position);
-
     const T3DVec3 camTarget = {{-35.0f, 100.0f, 0}};
 
     t3d_viewport_set_projection(&scene->viewport, T3D_DEG_TO_RAD(60.0f), 20.0f, 1000.0f);
@@ -133,7 +131,7 @@ int intro_update(SceneIntro* scene) {
 }
 
 void intro_render(SceneIntro* scene) {
-    rdpq_attach(display_get(), display_get_zbuf());
+    rdpq_attach(frame_pipeline_get_display(), display_get_zbuf());
     t3d_frame_start();
     t3d_viewport_attach(&scene->viewport);
 
@@ -159,13 +157,16 @@ void intro_render(SceneIntro* scene) {
     // Draw mecha model if loaded
     if (scene->mecha_model) {
         t3d_matrix_push(scene->modelMat);
+        if (scene->skeleton) {
+            animation_system_build_matrices(&scene->anim_system);
+        }
         
         T3DModelDrawConf drawConf = {
             .userData = NULL,
             .tileCb = NULL,
             .filterCb = NULL,
             .dynTextureCb = NULL,
-            .matrices = scene->skeleton ? scene->skeleton->boneMatricesFP : NULL
+            .matrices = animation_system_get_bone_matrices(scene->skeleton)
         };
         
         t3d_model_draw_custom(scene->mecha_model, drawConf);
@@ -193,7 +194,7 @@ void intro_render(SceneIntro* scene) {
     // Credits (left-aligned)
     rdpq_text_printf(NULL, 1, 10, 230, "parkerdev 2026");
 
-    rdpq_detach_show();
+    frame_pipeline_show();
 }
 
 void intro_cleanup(SceneIntro* scene) {
@@ -204,25 +205,27 @@ void intro_cleanup(SceneIntro* scene) {
     // Cleanup animation system
     if (scene->skeleton) {
         animation_system_cleanup(&scene->anim_system);
+        baked_pose_set_free(scene->poses);
+        scene->poses = NULL;
         t3d_skeleton_destroy(scene->skeleton);
-        free_uncached(scene->skeleton);
+        mem_free_cpu(scene->skeleton);
         scene->skeleton = NULL;
     }
 
     if (scene->mecha_model) {
-        t3d_model_free(scene->mecha_model);
+        asset_cache_release(scene->mecha_model);
     }
 
     if (scene->tunnel_model) {
-        t3d_model_free(scene->tunnel_model);
+        asset_cache_release(scene->tunnel_model);
     }
 
     if (scene->modelMat) {
-        free_uncached(scene->modelMat);
+        mem_free_rsp(scene->modelMat);
     }
     
     if (scene->tunnelMat) {
-        free_uncached(scene->tunnelMat);
+        mem_free_rsp(scene->tunnelMat);
     }
 
     if (scene->logo_sprite) {
@@ -13,6 +13,7 @@ typedef struct {
     T3DModel* mecha_model;
     T3DSkeleton* skeleton;
     AnimationSystem anim_system;
+    BakedPoseSet* poses;        // Baked Idle loop (falls back to the live clip if missing)
     T3DMat4FP* modelMat;
     
     // Map model
@@ -31,12 +32,14 @@ typedef struct {
     // Music
     wav64_t music;
     
-    float last_update_time;
     float scene_time;
 } SceneIntro;
 
+// Queue the intro models for background preloading
+void intro_queue_preload(void);
+
 void intro_init(SceneIntro* scene, rdpq_font_t* font);
-int intro_update(SceneIntro* scene);
+int intro_update(SceneIntro* scene, float delta_time);
 void intro_render(SceneIntro* scene);
 void intro_cleanup(SceneIntro* scene);
 
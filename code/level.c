@@ -0,0 +1,775 @@
+/**
+ * @file level.c
+ * @brief Shared level runtime, configured per level by a LevelDesc
+ */
+
+#include "level.h"
+#include "framepipeline.h"
+#include "mempolicy.h"
+#include "matrixring.h"
+#include "frameprofiler.h"
+#include "assetcache.h"
+#include "preload.h"
+#include "simclock.h"
+#include "bundle.h"
+#include "loadprofiler.h"
+
+// Shared by every level unless a description overrides it
+#define LEVEL_DEFAULT_START      {{0.0f, -200.0f, 0.0f}}
+#define LEVEL_DEFAULT_BOUNDARY   { .min_x = -150.0f, .max_x = 150.0f, .min_y = -250.0f, .max_y = -50.0f, .min_z = -10.0f, .max_z = 10.0f }
+#define LEVEL_DEFAULT_LIGHT_DIR  {{0.3f, -0.8f, 0.5f}}
+#define LEVEL_VICTORY_DURATION   6.0f
+#define LEVEL_MAX_MODELS         8
+#define LEVEL_UPPER_BODY_BONE    "Chest"
+#define LEVEL_LAYER_SLASH_LEFT   0
+#define LEVEL_LAYER_SLASH_RIGHT  1
+
+static const LevelDesc level_descs[] = {
+    {
+        .scene = LEVEL_1,
+        .next_scene = LEVEL_2,
+        .title = "DEEP SPACE",
+        .bundle_path = "rom:/level1.bnd",
+        .background_path = "rom:/stars.t3dm",
+        .enemy_model_path = "rom:/enemy1.t3dm",
+        .music_path = "rom:/HELIOS_EDGE.wav64",
+        .music_volume = 0.5f,
+        .enemy_mode = LEVEL_ENEMIES_LEVEL1,
+        .victory_waves = 5,
+        .boost_delay = 0.0f,
+        .fire_during_cutscenes = true,
+        .clear_color = {50, 50, 200},
+        .ambient_color = {180, 180, 180},
+        .light_color = {255, 255, 255},
+        .light_direction = LEVEL_DEFAULT_LIGHT_DIR,
+        .player_start = LEVEL_DEFAULT_START,
+        .boundary = LEVEL_DEFAULT_BOUNDARY,
+        .player_speed = 250.0f
+    },
+    {
+        .scene = LEVEL_2,
+        .next_scene = LEVEL_3,
+        .title = "MARS",
+        .bundle_path = "rom:/level2.bnd",
+        .background_path = "rom:/mars.t3dm",
+        .enemy_model_path = "rom:/enemy1.t3dm",
+        .music_path = "rom:/Disturbance.wav64",
+        .music_volume = 0.5f,
+        .enemy_mode = LEVEL_ENEMIES_BOSS,
+        .boss = BOSS_LEVEL2_BOMBER,
+        .boost_delay = 3.0f,
+        .fire_during_cutscenes = true,
+        .clear_color = {200, 50, 50},
+        .ambient_color = {180, 180, 180},
+        .light_color = {255, 200, 200},
+        .light_direction = LEVEL_DEFAULT_LIGHT_DIR,
+        .player_start = LEVEL_DEFAULT_START,
+        .boundary = LEVEL_DEFAULT_BOUNDARY,
+        .player_speed = 250.0f
+    },
+    {
+        .scene = LEVEL_3,
+        .next_scene = LEVEL_4,
+        .title = "JUPITER",
+        .bundle_path = "rom:/level3.bnd",
+        .background_path = "rom:/jupiter.t3dm",
+        .enemy_model_path = "rom:/enemy1.t3dm",
+        .music_path = "rom:/BGM022.wav64",
+        .music_volume = 0.5f,
+        .enemy_mode = LEVEL_ENEMIES_LEVEL3,
+        .victory_waves = 15,
+        .boost_delay = 0.0f,
+        .fire_during_cutscenes = false,
+        .clear_color = {79, 196, 151},
+        .ambient_color = {180, 180, 180},
+        .light_color = {200, 255, 200},
+        .light_direction = LEVEL_DEFAULT_LIGHT_DIR,
+        .player_start = LEVEL_DEFAULT_START,
+        .boundary = LEVEL_DEFAULT_BOUNDARY,
+        .player_speed = 250.0f
+    },
+    {
+        .scene = LEVEL_4,
+        .next_scene = LEVEL_5,
+        .title = "SUN",
+        .bundle_path = "rom:/level4.bnd",
+        .background_path = "rom:/sun.t3dm",
+        .enemy_model_path = "rom:/enemy1.t3dm",
+        .music_path = "rom:/Unsinkable_Battleship.wav64",
+        .music_volume = 0.5f,
+        .enemy_mode = LEVEL_ENEMIES_BOSS,
+        .boss = BOSS_LEVEL4,
+        .boost_delay = 0.0f,
+        .fire_during_cutscenes = false,
+        .clear_color = {200, 200, 50},
+        .ambient_color = {180, 180, 180},
+        .light_color = {255, 255, 200},
+        .light_direction = LEVEL_DEFAULT_LIGHT_DIR,
+        .player_start = LEVEL_DEFAULT_START,
+        .boundary = LEVEL_DEFAULT_BOUNDARY,
+        .player_speed = 250.0f
+    },
+    {
+        .scene = LEVEL_5,
+        .next_scene = SCENE_END,
+        .title = "MERCURY",
+        .bundle_path = "rom:/level5.bnd",
+        .background_path = "rom:/mercury.t3dm",
+        .enemy_model_path = "rom:/enemy1.t3dm",
+        .music_path = "rom:/Canter_Ninety.wav64",
+        .music_volume = 0.25f,
+        .enemy_mode = LEVEL_ENEMIES_BOSS,
+        .boss = BOSS_LEVEL5,
+        .boost_delay = 0.0f,
+        .fire_during_cutscenes = false,
+        .clear_color = {0, 0, 128},
+        .ambient_color = {180, 180, 180},
+        .light_color = {200, 200, 255},
+        .light_direction = LEVEL_DEFAULT_LIGHT_DIR,
+        .player_start = LEVEL_DEFAULT_START,
+        .boundary = LEVEL_DEFAULT_BOUNDARY,
+        .player_speed = 250.0f
+    }
+};
+
+const LevelDesc* level_desc_get(GameScene scene) {
+    for (size_t i = 0; i < sizeof(level_descs) / sizeof(level_descs[0]); i++) {
+        if (level_descs[i].scene == scene) return &level_descs[i];
+    }
+    return NULL;
+}
+
+// Every model the level acquires, in load order
+static int level_model_paths(const LevelDesc* desc, const char* paths[LEVEL_MAX_MODELS]) {
+    int count = 0;
+    paths[count++] = LEVEL_MECHA_MODEL_PATH;
+    paths[count++] = desc->background_path;
+    paths[count++] = desc->enemy_model_path;
+    if (desc->enemy_mode == LEVEL_ENEMIES_BOSS) {
+        const BossDef* boss = boss_def_get(desc->boss);
+        if (boss) paths[count++] = boss->assets.model_path;
+    }
+    paths[count++] = EXPLOSION_MODEL_PATH;
+    paths[count++] = PROJECTILE_NORMAL_MODEL_PATH;
+    paths[count++] = PROJECTILE_SLASH_MODEL_PATH;
+    paths[count++] = PROJECTILE_ENEMY_MODEL_PATH;
+    return count;
+}
+
+void level_queue_preload(const LevelDesc* desc) {
+    if (!desc) return;
+    
+    const char* paths[LEVEL_MAX_MODELS];
+    int count = level_model_paths(desc, paths);
+    for (int i = 0; i < count; i++) {
+        preload_queue_add_model(paths[i]);
+    }
+    preload_queue_add_sprite(PLAYER_HEALTH_SPRITE_PATH);
+}
+
+// The bundle is only worth reading if the cache is missing something it holds
+static bool level_needs_bundle(const LevelDesc* desc) {
+    if (!desc->bundle_path) return false;
+    
+    const char* paths[LEVEL_MAX_MODELS];
+    int count = level_model_paths(desc, paths);
+    for (int i = 0; i < count; i++) {
+        if (!asset_cache_is_resident(paths[i])) return true;
+    }
+    return !asset_cache_is_resident(PLAYER_HEALTH_SPRITE_PATH);
+}
+
+static T3DModel* level_load_model(const char* path) {
+    T3DModel* model = asset_cache_get_model(path);
+    if (!model) {
+        debugf("WARNING: Failed to load %s\n", path);
+    } else {
+        debugf("Successfully loaded %s\n", path);
+    }
+    return model;
+}
+
+void level_init(Level* level, const LevelDesc* desc, rdpq_font_t* font) {
+    level->desc = desc;
+    
+    // Missing models and sprites come from one sequential bundle read
+    Bundle bundle;
+    bool bundled = false;
+    if (level_needs_bundle(desc)) {
+        LOAD_PROFILE("bundle", desc->bundle_path, bundled = bundle_open(&bundle, desc->bundle_path));
+    }
+    if (bundled) bundle_mount(&bundle);
+    
+    // Set up camera viewport
+    level->viewport = t3d_viewport_create();
+    
+    // Load mecha model
+    level->mecha_model = level_load_model(LEVEL_MECHA_MODEL_PATH);
+    
+    // Initialize skeleton for rigged model
+    const T3DChunkSkeleton* skelChunk = level->mecha_model ? t3d_model_get_skeleton(level->mecha_model) : NULL;
+    if (skelChunk) {
+        level->skeleton = mem_alloc_cpu(sizeof(T3DSkeleton));
+        LOAD_PROFILE("skeleton", LEVEL_MECHA_MODEL_PATH, *level->skeleton = t3d_skeleton_create_buffered(level->mecha_model, FRAME_PIPELINE_DEPTH));
+        
+        // Initialize animation system
+        LOAD_PROFILE("anim", LEVEL_MECHA_MODEL_PATH, animation_system_init(&level->anim_system, level->mecha_model, level->skeleton));
+        
+        // Resolve player clips once so switching never searches by name
+        level->clip_combat_left = animation_system_find_clip(&level->anim_system, "CombatLeft");
+        level->clip_combat_right = animation_system_find_clip(&level->anim_system, "CombatRight");
+        level->clip_slash_left = animation_system_find_clip(&level->anim_system, "SlashLeft");
+        level->clip_slash_right = animation_system_find_clip(&level->anim_system, "SlashRight");
+        level->clip_boost = animation_system_find_clip(&level->anim_system, "Boost");
+        level->upper_body_mask = animation_system_get_bone_mask(&level->anim_system, LEVEL_UPPER_BODY_BONE);
+        
+        // Start with CombatLeft animation (since player starts at center which is "left")
+        animation_system_play_clip(&level->anim_system, level->clip_combat_left, true);
+    } else {
+        debugf("No skeleton found in model\n");
+        level->skeleton = NULL;
+    }
+    
+    // Mecha is drawn where the player controls start, so the first frame has nothing to interpolate
+    level->player_draw_position = desc->player_start;
+    level->player_prev_position = level->player_draw_position;
+    
+    // Load explosion model
+    level->explosion_model = level_load_model(EXPLOSION_MODEL_PATH);
+    // Initialize explosion at player starting position (off-screen below)
+    level->explosion_position = (T3DVec3){{0.0f, -250.0f, 0.0f}};
+    
+    // Load background map and bake its Rotate clip into a rigid spin (no skeleton kept)
+    level->background_model = level_load_model(desc->background_path);
+    LOAD_PROFILE("bake", desc->background_path, background_spinner_init(&level->background_spinner, level->background_model, "Rotate"));
+    
+    // Load enemy model
+    level->enemy_model = level_load_model(desc->enemy_model_path);
+    
+    // Initialize player controls with boundaries
+    playercontrols_init(&level->player_controls, desc->player_start, desc->boundary, desc->player_speed);
+    
+    // Initialize slash animation state
+    level->is_slashing = false;
+    level->slash_triggered = false;
+    level->slash_timer = 0.0f;
+    
+    // Initialize outfit system
+    LOAD_PROFILE("init", "outfits", outfit_system_init(&level->outfit_system, level->mecha_model));
+    
+    // Initialize projectile system (speed: 1000, lifetime: 3s, normal_cooldown: 0.2s, slash_cooldown: 1.5s)
+    LOAD_PROFILE("init", "projectiles", projectile_system_init(&level->projectile_system, 1000.0f, 3.0f, 0.2f, 1.5f));
+    
+    // Initialize collision system
+    collision_system_init(&level->collision_system);
+    
+    // Extract collision boxes for player model only
+    LOAD_PROFILE("collision", "player", collision_system_extract_from_model(&level->collision_system, level->mecha_model, "PLAYER_", COLLISION_PLAYER));
+    
+    // Initialize enemy orchestrator (will handle enemy spawning and collision)
+    LOAD_PROFILE("init", "enemies", enemy_orchestrator_init(&level->enemy_orchestrator, level->enemy_model, &level->collision_system));
+    if (desc->enemy_mode == LEVEL_ENEMIES_BOSS) {
+        LOAD_PROFILE("init", "boss", enemy_orchestrator_init_boss(&level->enemy_orchestrator, desc->boss));
+    }
+    
+    // Player animates every frame; bosses at a reduced, budgeted rate
+    anim_scheduler_init(&level->anim_scheduler, ANIM_SCHEDULER_DEFAULT_BUDGET);
+    if (level->skeleton) {
+        anim_scheduler_add(&level->anim_scheduler, &level->anim_system, NULL, NULL, 0.0f, 1);
+    }
+    if (desc->enemy_mode == LEVEL_ENEMIES_BOSS) {
+        enemy_orchestrator_schedule_boss(&level->enemy_orchestrator, &level->anim_scheduler);
+    }
+    
+    debugf("Collision system initialized with %d boxes\n", level->collision_system.count);
+    
+    // Initialize victory state
+    level->victory = false;
+    level->victory_timer = 0.0f;
+    level->boost_started = false;
+    
+    // Initialize player health system
+    LOAD_PROFILE("init", "health", player_health_init(&level->player_health, &level->collision_system));
+    
+    // Use pre-loaded font
+    level->font = font;
+    rdpq_text_register_font(1, level->font);
+    
+    // Initialize title animation
+    title_animation_init(&level->title_anim, desc->title);
+    
+    // Set up lighting
+    for (int i = 0; i < 3; i++) {
+        level->colorAmbient[i] = desc->ambient_color[i];
+        level->colorDir[i] = desc->light_color[i];
+    }
+    level->colorAmbient[3] = 0xFF;
+    level->colorDir[3] = 0xFF;
+    
+    level->lightDirVec = desc->light_direction;
+    t3d_vec3_norm(&level->lightDirVec);
+    
+    // Everything has been copied out of the bundle; music streams from ROM
+    if (bundled) {
+        bundle_unmount();
+        bundle_close(&bundle);
+    }
+    
+    // Load music (playback starts in level_resume)
+    LOAD_PROFILE("audio", desc->music_path, wav64_open(&level->music, desc->music_path));
+    wav64_set_loop(&level->music, true);
+}
+
+void level_suspend(Level* level) {
+    (void)level;
+    mixer_ch_stop(0);
+}
+
+void level_resume(Level* level) {
+    mixer_ch_set_limits(0, 0, 48000, 0);
+    wav64_play(&level->music, 0);
+    mixer_ch_set_vol(0, level->desc->music_volume, level->desc->music_volume);
+}
+
+// Victory rule for the level's enemy mode
+static bool level_enemies_defeated(Level* level) {
+    EnemyOrchestrator* orch = &level->enemy_orchestrator;
+    if (level->desc->enemy_mode == LEVEL_ENEMIES_BOSS) {
+        return orch->wave_count > 0 && orch->active_count == 0;
+    }
+    return enemy_orchestrator_all_waves_complete(orch, level->desc->victory_waves);
+}
+
+static void level_update_enemies(Level* level, float delta_time) {
+    switch (level->desc->enemy_mode) {
+        case LEVEL_ENEMIES_LEVEL1:
+            enemy_orchestrator_update_level1(&level->enemy_orchestrator, delta_time);
+            enemy_orchestrator_spawn_projectiles_level1(&level->enemy_orchestrator, &level->projectile_system, delta_time);
+            break;
+        case LEVEL_ENEMIES_LEVEL3:
+            enemy_orchestrator_update_level3(&level->enemy_orchestrator, delta_time);
+            enemy_orchestrator_spawn_projectiles_level3(&level->enemy_orchestrator, &level->projectile_system, delta_time);
+            break;
+        case LEVEL_ENEMIES_BOSS:
+            // Movement, attacks and health
+            enemy_orchestrator_update_boss(&level->enemy_orchestrator, delta_time, &level->projectile_system);
+            break;
+    }
+}
+
+// Slash on the upper body over the combat blend: SlashLeft at full weight with SlashRight
+// over it weighted by position, the same mix the full-body position blend gave those bones
+static void level_start_slash(Level* level, float normalized_x) {
+    if (!level->skeleton) return;
+    
+    animation_system_play_layer(&level->anim_system, LEVEL_LAYER_SLASH_LEFT, level->clip_slash_left,
+                                ANIM_LAYER_OVERRIDE, level->upper_body_mask, 1.0f, false);
+    animation_system_play_layer(&level->anim_system, LEVEL_LAYER_SLASH_RIGHT, level->clip_slash_right,
+                                ANIM_LAYER_OVERRIDE, level->upper_body_mask, normalized_x, false);
+}
+
+static void level_stop_slash(Level* level) {
+    level->is_slashing = false;
+    level->slash_triggered = false;
+    level->slash_timer = 0.0f;
+    if (!level->skeleton) return;
+    
+    animation_system_stop_layer(&level->anim_system, LEVEL_LAYER_SLASH_RIGHT);
+    animation_system_stop_layer(&level->anim_system, LEVEL_LAYER_SLASH_LEFT);
+}
+
+static void level_handle_fire(Level* level, joypad_buttons_t btn_held, T3DVec3 player_pos) {
+    // A button - shoot slash projectile (hold for continuous fire)
+    if (btn_held.a && projectile_system_can_shoot(&level->projectile_system, PROJECTILE_SLASH)) {
+        T3DVec3 spawn_pos = {{player_pos.v[0], player_pos.v[1] + 100.0f, player_pos.v[2]}};
+        T3DVec3 shoot_direction = {{0.0f, 0.0f, -1.0f}};
+        projectile_system_spawn(&level->projectile_system, spawn_pos, shoot_direction, PROJECTILE_SLASH);
+        // Activate thrust outfit for 1.5 seconds
+        outfit_system_activate_thrust(&level->outfit_system, 1.5f);
+        // Trigger slash animation (duration matches slash cooldown)
+        level->is_slashing = true;
+        level->slash_triggered = true;
+        level->slash_timer = 1.5f;
+    }
+    
+    // B button - shoot normal projectile (hold for continuous fire)
+    if (btn_held.b && projectile_system_can_shoot(&level->projectile_system, PROJECTILE_NORMAL)) {
+        // Offset spawn position higher (where gun would be)
+        T3DVec3 spawn_pos = {{player_pos.v[0], player_pos.v[1] + 100.0f, player_pos.v[2]}};
+        T3DVec3 shoot_direction = {{0.0f, 0.0f, -1.0f}};  // Forward direction
+        projectile_system_spawn(&level->projectile_system, spawn_pos, shoot_direction, PROJECTILE_NORMAL);
+    }
+}
+
+int level_update(Level* level, float delta_time) {
+    const LevelDesc* desc = level->desc;
+    
+    // Keep the last tick's position so rendering can interpolate between ticks
+    level->player_prev_position = level->player_draw_position;
+    
+    // Update player and boss animation
+    PROF(PROF_ANIMATION, anim_scheduler_update(&level->anim_scheduler, delta_time, &level->viewport));
+    
+    // Update background spin
+    background_spinner_update(&level->background_spinner, delta_time);
+    
+    // Handle input
+    joypad_buttons_t btn_held = joypad_get_buttons_held(JOYPAD_PORT_1);
+    joypad_inputs_t inputs = joypad_get_inputs(JOYPAD_PORT_1);
+    
+    // Update player health system first (needed for death timer)
+    player_health_update(&level->player_health, delta_time);
+    
+    // Update explosion position when dead
+    if (player_health_is_dead(&level->player_health)) {
+        // Position explosion at player location (offset up by 100 units)
+        T3DVec3 player_pos = playercontrols_get_position(&level->player_controls);
+        level->explosion_position = (T3DVec3){{player_pos.v[0], player_pos.v[1] + 100.0f, player_pos.v[2]}};
+    }
+    
+    // Restart in place once the death timer runs out
+    if (player_health_should_reload(&level->player_health)) {
+        level_soft_reset(level);
+        return -1;
+    }
+    
+    // If player is dead, skip gameplay updates but still render
+    if (player_health_is_dead(&level->player_health)) {
+        goto skip_to_camera;
+    }
+    
+    // Check for victory condition
+    if (!level->victory && level_enemies_defeated(level)) {
+        level->victory = true;
+        level->victory_timer = 0.0f;
+        
+        // Move player to center of boundary
+        float center_x = (level->player_controls.boundary.min_x + level->player_controls.boundary.max_x) / 2.0f;
+        T3DVec3 center_pos = {{center_x, level->player_controls.position.v[1], level->player_controls.position.v[2]}};
+        playercontrols_set_position(&level->player_controls, center_pos);
+    }
+    
+    // Update victory timer and advance to next scene
+    if (level->victory) {
+        level->victory_timer += delta_time;
+        
+        // Play Boost animation once the level's delay has passed
+        if (!level->boost_started && level->victory_timer >= desc->boost_delay) {
+            level_stop_slash(level);
+            animation_system_play_clip(&level->anim_system, level->clip_boost, false);
+            level->boost_started = true;
+        }
+        
+        if (level->victory_timer >= LEVEL_VICTORY_DURATION) {
+            return desc->next_scene;
+        }
+        // Skip rest of update during victory
+        goto skip_to_camera;
+    }
+    
+    // Update player controls (skip during victory)
+    playercontrols_update(&level->player_controls, inputs, delta_time);
+    
+    // Update slash timer
+    if (level->is_slashing) {
+        level->slash_timer -= delta_time;
+        if (level->slash_timer <= 0.0f) {
+            level_stop_slash(level);
+        }
+    }
+    
+    // Update player animation based on position and state (with blending)
+    T3DVec3 player_pos = playercontrols_get_position(&level->player_controls);
+    float boundary_width = level->player_controls.boundary.max_x - level->player_controls.boundary.min_x;
+    float normalized_x = (player_pos.v[0] - level->player_controls.boundary.min_x) / boundary_width;
+    
+    // Combat blend drives the whole body; a slash is layered over the upper body
+    animation_system_update_position_blend_clip(&level->anim_system, normalized_x, level->clip_combat_left, level->clip_combat_right, true);
+    if (level->slash_triggered) {
+        level_start_slash(level, normalized_x);
+        level->slash_triggered = false;
+    } else if (level->is_slashing) {
+        animation_system_set_layer_weight(&level->anim_system, LEVEL_LAYER_SLASH_RIGHT, normalized_x);
+    }
+    
+    // Update outfit system
+    outfit_system_update(&level->outfit_system, delta_time);
+    
+    // Update enemies (spawning, movement, attacks and individual enemy systems)
+    PROF(PROF_ENEMIES, level_update_enemies(level, delta_time));
+    
+    // Update title animation
+    title_animation_update(&level->title_anim, delta_time);
+    
+    // Update collision boxes to match current player position
+    PROF(PROF_COLLISION, collision_system_update_boxes_by_type(&level->collision_system, COLLISION_PLAYER, &level->player_draw_position));
+    
+    // Update projectiles (movement only, no collision yet)
+    PROF(PROF_PROJECTILES, projectile_system_update(&level->projectile_system, delta_time));
+    
+    // Manual collision checking for projectiles
+    PROF_BEGIN(PROF_COLLISION);
+    for (int i = 0; i < MAX_PROJECTILES; i++) {
+        Projectile* proj = projectile_system_get_projectile(&level->projectile_system, i);
+        if (!proj || !proj->active) continue;
+        
+        if (proj->is_enemy) {
+            // Enemy projectile - check collision with player
+            char hit_name[64];
+            if (!player_health_is_dead(&level->player_health) &&
+                collision_system_check_point(&level->collision_system, &proj->position, COLLISION_PLAYER, hit_name)) {
+                player_health_take_damage(&level->player_health, 1);
+                projectile_system_deactivate(&level->projectile_system, i);
+            }
+        } else {
+            // Player projectile - check collision with enemies
+            int hit_enemy_index = -1;
+            if (enemy_orchestrator_check_hit(&level->enemy_orchestrator, &proj->position, &hit_enemy_index, proj->damage)) {
+                projectile_system_deactivate(&level->projectile_system, i);
+            }
+        }
+    }
+    PROF_END(PROF_COLLISION);
+    
+    if (!desc->fire_during_cutscenes) {
+        level_handle_fire(level, btn_held, player_pos);
+    }
+
+skip_to_camera:
+    // Update player position for rendering
+    player_pos = playercontrols_get_position(&level->player_controls);
+    
+    if (desc->fire_during_cutscenes) {
+        level_handle_fire(level, btn_held, player_pos);
+    }
+    
+    // Set up camera
+    const T3DVec3 camPos = {{0, 0.0f, 200.0f}};
+    const T3DVec3 camTarget = {{0, -50.0f, 0}};
+    
+    t3d_viewport_set_projection(&level->viewport, T3D_DEG_TO_RAD(60.0f), 20.0f, 1000.0f);
+    t3d_viewport_look_at(&level->viewport, &camPos, &camTarget, &(T3DVec3){{0,1,0}});
+    
+    // Remember where to draw the mecha (its matrix is built at render time)
+    level->player_draw_position = player_pos;
+    
+    return -1; // No transition
+}
+
+void level_soft_reset(Level* level) {
+    const LevelDesc* desc = level->desc;
+    uint64_t start_us = get_ticks_us();
+    
+    // Dropping enemy collision boxes leaves only the player's, then the boss respawns
+    enemy_orchestrator_reset(&level->enemy_orchestrator);
+    projectile_system_reset(&level->projectile_system);
+    player_health_reset(&level->player_health);
+    title_animation_reset(&level->title_anim);
+    
+    playercontrols_init(&level->player_controls, desc->player_start, desc->boundary, desc->player_speed);
+    level->player_draw_position = desc->player_start;
+    level->player_prev_position = level->player_draw_position;
+    level->explosion_position = (T3DVec3){{0.0f, -250.0f, 0.0f}};
+    
+    level_stop_slash(level);
+    outfit_system_set_outfit(&level->outfit_system, OUTFIT_BASE);
+    level->outfit_system.thrust_timer = 0.0f;
+    if (level->skeleton) {
+        animation_system_play_clip(&level->anim_system, level->clip_combat_left, true);
+    }
+    
+    level->victory = false;
+    level->victory_timer = 0.0f;
+    level->boost_started = false;
+    
+    debugf("%s restarted in %.2f ms\n", desc->title, (get_ticks_us() - start_us) / 1000.0f);
+}
+
+void level_render(Level* level, float alpha) {
+    const LevelDesc* desc = level->desc;
+    
+    rdpq_attach(frame_pipeline_get_display(), display_get_zbuf());
+    t3d_frame_start();
+    t3d_viewport_attach(&level->viewport);
+    PROF_BEGIN(PROF_PASS_WORLD);
+    
+    // Clear screen to the level's background color
+    t3d_screen_clear_color(RGBA32(desc->clear_color[0], desc->clear_color[1], desc->clear_color[2], 0xFF));
+    t3d_screen_clear_depth();
+    
+    // Set render flags
+    t3d_state_set_drawflags(T3D_FLAG_SHADED | T3D_FLAG_TEXTURED | T3D_FLAG_DEPTH);
+    
+    // Set up lighting
+    t3d_light_set_ambient(level->colorAmbient);
+    t3d_light_set_directional(0, level->colorDir, &level->lightDirVec);
+    t3d_light_set_count(1);
+    
+    // Draw background map if loaded
+    background_spinner_draw(&level->background_spinner);
+    PROF_END(PROF_PASS_WORLD);
+    PROF_BEGIN(PROF_PASS_ACTORS);
+    
+    // Draw all active enemies from orchestrator (boss slot uses the boss model and skeleton)
+    T3DModel* boss_model = enemy_orchestrator_get_boss_model(&level->enemy_orchestrator);
+    T3DSkeleton* boss_skeleton = enemy_orchestrator_get_boss_skeleton(&level->enemy_orchestrator);
+    if (boss_model && boss_skeleton) {
+        // Once per rendered frame, however many ticks advanced the boss pose
+        animation_system_build_matrices(enemy_orchestrator_get_boss_anim(&level->enemy_orchestrator));
+    }
+    
+    for (int i = 0; i < MAX_ENEMIES; i++) {
+        if (!enemy_orchestrator_is_active(&level->enemy_orchestrator, i)) continue;
+        
+        bool is_boss = boss_model && enemy_orchestrator_is_boss(&level->enemy_orchestrator, i);
+        T3DModel* render_model = is_boss ? boss_model : level->enemy_model;
+        if (!render_model) continue;
+        
+        EnemySystem* enemy_sys = enemy_orchestrator_get_system(&level->enemy_orchestrator, i);
+        T3DMat4FP* enemy_mat = enemy_orchestrator_get_matrix(&level->enemy_orchestrator, i, alpha);
+        if (!enemy_sys || !enemy_mat) continue;
+        
+        // Apply red lighting if flashing
+        if (enemy_system_is_flashing(enemy_sys)) {
+            uint8_t flashColor[4] = {255, 80, 80, 0xFF};
+            t3d_light_set_ambient(flashColor);
+            t3d_light_set_directional(0, flashColor, &level->lightDirVec);
+        }
+        
+        t3d_matrix_push(enemy_mat);
+        
+        T3DModelDrawConf enemyDrawConf = {
+            .userData = NULL,
+            .tileCb = NULL,
+            .filterCb = NULL,
+            .dynTextureCb = NULL,
+            .matrices = animation_system_get_bone_matrices(is_boss ? boss_skeleton : NULL)
+        };
+        
+        t3d_model_draw_custom(render_model, enemyDrawConf);
+        
+        t3d_matrix_pop(1);
+        
+        // Restore normal lighting
+        if (enemy_system_is_flashing(enemy_sys)) {
+            t3d_light_set_ambient(level->colorAmbient);
+            t3d_light_set_directional(0, level->colorDir, &level->lightDirVec);
+        }
+    }
+    
+    // Draw enemy explosions
+    explosion_system_render(enemy_orchestrator_get_explosions(&level->enemy_orchestrator));
+    
+    // Draw mecha model if loaded and player is alive, or explosion if dead
+    if (player_health_is_dead(&level->player_health) && level->explosion_model) {
+        // Draw explosion higher up
+        float exp_scale[3] = {1.0f, 1.0f, 1.0f};
+        float exp_rotation[3] = {0.0f, 0.0f, 0.0f};
+        float exp_position[3] = {level->explosion_position.v[0], level->explosion_position.v[1], level->explosion_position.v[2]};
+        t3d_matrix_push(matrix_ring_srt_euler(exp_scale, exp_rotation, exp_position));
+        
+        T3DModelDrawConf drawConf = {
+            .userData = NULL,
+            .tileCb = NULL,
+            .filterCb = NULL,
+            .dynTextureCb = NULL,
+            .matrices = NULL
+        };
+        
+        t3d_model_draw_custom(level->explosion_model, drawConf);
+        t3d_matrix_pop(1);
+    } else if (level->mecha_model) {
+        // Apply red lighting if player is flashing
+        if (player_health_is_flashing(&level->player_health)) {
+            uint8_t flashColor[4] = {255, 80, 80, 0xFF};
+            t3d_light_set_ambient(flashColor);
+            t3d_light_set_directional(0, flashColor, &level->lightDirVec);
+        }
+        
+        float scale[3] = {1.0f, 1.0f, 1.0f};
+        float rotation[3] = {0.0f, T3D_DEG_TO_RAD(180.0f), 0.0f};
+        T3DVec3 draw_pos = sim_lerp_vec3(&level->player_prev_position, &level->player_draw_position, alpha);
+        float position[3] = {draw_pos.v[0], draw_pos.v[1], draw_pos.v[2]};
+        t3d_matrix_push(matrix_ring_srt_euler(scale, rotation, position));
+        if (level->skeleton) {
+            animation_system_build_matrices(&level->anim_system);
+        }
+        
+        T3DModelDrawConf drawConf = {
+            .userData = &level->outfit_system,
+            .tileCb = NULL,
+            .filterCb = outfit_system_filter_callback,
+            .dynTextureCb = NULL,
+            .matrices = animation_system_get_bone_matrices(level->skeleton)
+        };
+        
+        t3d_model_draw_custom(level->mecha_model, drawConf);
+        t3d_matrix_pop(1);
+        
+        // Restore normal lighting
+        if (player_health_is_flashing(&level->player_health)) {
+            t3d_light_set_ambient(level->colorAmbient);
+            t3d_light_set_directional(0, level->colorDir, &level->lightDirVec);
+        }
+    }
+    
+    // Draw projectiles
+    projectile_system_render(&level->projectile_system, alpha);
+    PROF_END(PROF_PASS_ACTORS);
+    PROF_BEGIN(PROF_PASS_HUD);
+    
+    // Draw UI
+    title_animation_render(&level->title_anim, level->font, 1, 70);
+    
+    // Draw player health
+    player_health_render(&level->player_health);
+    PROF_END(PROF_PASS_HUD);
+    
+    frame_pipeline_show();
+}
+
+void level_cleanup(Level* level) {
+    // Cleanup animation system
+    if (level->skeleton) {
+        animation_system_cleanup(&level->anim_system);
+        t3d_skeleton_destroy(level->skeleton);
+        mem_free_cpu(level->skeleton);
+        level->skeleton = NULL;
+    }
+    
+    // Cleanup background spinner
+    background_spinner_cleanup(&level->background_spinner);
+    
+    if (level->mecha_model) {
+        asset_cache_release(level->mecha_model);
+        level->mecha_model = NULL;
+    }
+    
+    if (level->explosion_model) {
+        asset_cache_release(level->explosion_model);
+        level->explosion_model = NULL;
+    }
+    
+    if (level->background_model) {
+        asset_cache_release(level->background_model);
+        level->background_model = NULL;
+    }
+    
+    if (level->enemy_model) {
+        asset_cache_release(level->enemy_model);
+        level->enemy_model = NULL;
+    }
+    
+    // Cleanup player health system
+    player_health_cleanup(&level->player_health);
+    
+    enemy_orchestrator_cleanup(&level->enemy_orchestrator);
+    
+    projectile_system_cleanup(&level->projectile_system);
+    
+    collision_system_cleanup(&level->collision_system);
+    
+    mixer_ch_stop(0);
+    wav64_close(&level->music);
+    rdpq_text_unregister_font(1);
+}
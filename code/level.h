@@ -0,0 +1,152 @@
+#ifndef LEVEL_H
+#define LEVEL_H
+
+#include <libdragon.h>
+#include <t3d/t3d.h>
+#include <t3d/t3dmodel.h>
+#include "scenes.h"
+#include "animationsystem.h"
+#include "animscheduler.h"
+#include "backgroundspinner.h"
+#include "bossruntime.h"
+#include "playercontrols.h"
+#include "outfitsystem.h"
+#include "projectilesystem.h"
+#include "collisionsystem.h"
+#include "enemyorchestrator.h"
+#include "titleanimation.h"
+#include "playerhealthsystem.h"
+
+#define LEVEL_MECHA_MODEL_PATH "rom:/mecha.t3dm"
+
+// How a level drives its enemies
+typedef enum {
+    LEVEL_ENEMIES_LEVEL1,   // Curved attack waves (update_level1 + spawn_projectiles_level1)
+    LEVEL_ENEMIES_LEVEL3,   // Zigzag waves (update_level3 + spawn_projectiles_level3)
+    LEVEL_ENEMIES_BOSS      // Single boss from bossruntime
+} LevelEnemyMode;
+
+// Level description (stored in ROM)
+typedef struct {
+    GameScene scene;                // Scene this description belongs to
+    GameScene next_scene;           // Scene entered after the victory sequence
+    const char* title;
+    
+    // Assets
+    const char* bundle_path;        // Level's models and sprites packed for one read (NULL = none)
+    const char* background_path;    // Spinning map, "Rotate" clip baked by BackgroundSpinner
+    const char* enemy_model_path;
+    const char* music_path;
+    float music_volume;
+    
+    // Enemies and victory
+    LevelEnemyMode enemy_mode;
+    BossId boss;                    // LEVEL_ENEMIES_BOSS only
+    int victory_waves;              // Waves to clear (wave modes only)
+    float boost_delay;              // Seconds into the victory before the Boost clip plays
+    bool fire_during_cutscenes;     // Shots allowed while dead or in the victory sequence
+    
+    // Lighting
+    uint8_t clear_color[3];
+    uint8_t ambient_color[3];
+    uint8_t light_color[3];
+    T3DVec3 light_direction;
+    
+    // Player
+    T3DVec3 player_start;
+    PlayerBoundary boundary;
+    float player_speed;
+} LevelDesc;
+
+typedef struct {
+    const LevelDesc* desc;
+    
+    T3DViewport viewport;
+    rdpq_font_t* font;
+    
+    // Character model
+    T3DModel* mecha_model;
+    T3DSkeleton* skeleton;
+    AnimationSystem anim_system;
+    AnimScheduler anim_scheduler;  // Drives player and boss animation
+    T3DVec3 player_draw_position;  // Mecha position, drawn with a per-frame ring matrix
+    T3DVec3 player_prev_position;  // Position one simulation tick earlier, for interpolation
+    
+    // Explosion model
+    T3DModel* explosion_model;
+    T3DVec3 explosion_position;    // Death explosion position
+    
+    // Background map model
+    T3DModel* background_model;
+    BackgroundSpinner background_spinner;
+    
+    // Enemy model and orchestrator
+    T3DModel* enemy_model;
+    EnemyOrchestrator enemy_orchestrator;
+    
+    // Player controls
+    PlayerControls player_controls;
+    
+    // Player animation state
+    bool is_slashing;
+    bool slash_triggered;          // Fired this tick; the slash layers start on the next animation update
+    float slash_timer;
+    uint32_t upper_body_mask;      // Bones the slash layers play on
+    
+    // Player clip IDs, resolved once at init
+    int clip_combat_left;
+    int clip_combat_right;
+    int clip_slash_left;
+    int clip_slash_right;
+    int clip_boost;
+    
+    // Victory state
+    bool victory;
+    float victory_timer;
+    bool boost_started;
+    
+    // Outfit system
+    OutfitSystem outfit_system;
+    
+    // Projectile system
+    ProjectileSystem projectile_system;
+    
+    // Collision system
+    CollisionSystem collision_system;
+    
+    // Player health system
+    PlayerHealthSystem player_health;
+    
+    // Lighting
+    uint8_t colorAmbient[4];
+    uint8_t colorDir[4];
+    T3DVec3 lightDirVec;
+    
+    // Title animation
+    TitleAnimation title_anim;
+    
+    wav64_t music;
+} Level;
+
+// Get the description for a level scene (NULL if the scene is not a level)
+const LevelDesc* level_desc_get(GameScene scene);
+
+// Queue every model and sprite the level acquires for background preloading
+void level_queue_preload(const LevelDesc* desc);
+
+void level_init(Level* level, const LevelDesc* desc, rdpq_font_t* font);
+int level_update(Level* level, float delta_time);
+
+// Restart the level in place after a death: simulation state is rewound while
+// models, skeletons, baked backgrounds and music stay resident
+void level_soft_reset(Level* level);
+void level_render(Level* level, float alpha);
+
+// Stop the music as soon as a transition away starts
+void level_suspend(Level* level);
+
+// Start the music right before the first update
+void level_resume(Level* level);
+void level_cleanup(Level* level);
+
+#endif // LEVEL_H
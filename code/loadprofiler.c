@@ -0,0 +1,94 @@
+/**
+ * @file loadprofiler.c
+ * @brief Per-step timing of scene loads, dumped after each transition
+ */
+
+#include "loadprofiler.h"
+
+#ifdef DEBUG
+
+#include <string.h>
+
+typedef struct {
+    char label[LOAD_PROFILER_LABEL_MAX];
+    const char* kind;           // String literal
+    uint32_t us;
+    uint32_t bytes;             // Heap growth during the step
+    int depth;                  // 0 = top-level step
+} LoadStep;
+
+static LoadStep profiler_ring[LOAD_PROFILER_RING];
+static int profiler_count = 0;          // Steps recorded since begin (may exceed the ring)
+static int profiler_depth = 0;
+static uint64_t profiler_start_us = 0;
+static char profiler_from[16];
+static char profiler_to[16];
+
+static size_t heap_used(void) {
+    heap_stats_t stats;
+    sys_get_heap_stats(&stats);
+    return (size_t)stats.used;
+}
+
+void load_profiler_begin(const char* from, const char* to) {
+    strncpy(profiler_from, from ? from : "none", sizeof(profiler_from) - 1);
+    strncpy(profiler_to, to ? to : "none", sizeof(profiler_to) - 1);
+    profiler_count = 0;
+    profiler_depth = 0;
+    profiler_start_us = get_ticks_us();
+}
+
+LoadMark load_profiler_mark(void) {
+    LoadMark mark = {
+        .start_us = get_ticks_us(),
+        .heap_before = heap_used(),
+        .depth = profiler_depth++
+    };
+    return mark;
+}
+
+void load_profiler_record(const char* kind, const char* label, LoadMark mark) {
+    uint32_t us = (uint32_t)(get_ticks_us() - mark.start_us);
+    size_t heap_after = heap_used();
+    profiler_depth = mark.depth;
+    
+    LoadStep* step = &profiler_ring[profiler_count % LOAD_PROFILER_RING];
+    strncpy(step->label, label ? label : "?", LOAD_PROFILER_LABEL_MAX - 1);
+    step->label[LOAD_PROFILER_LABEL_MAX - 1] = '\0';
+    step->kind = kind;
+    step->us = us;
+    step->bytes = heap_after > mark.heap_before ? (uint32_t)(heap_after - mark.heap_before) : 0;
+    step->depth = mark.depth;
+    profiler_count++;
+}
+
+static int load_step_compare(const void* a, const void* b) {
+    const LoadStep* sa = (const LoadStep*)a;
+    const LoadStep* sb = (const LoadStep*)b;
+    return (sb->us > sa->us) - (sb->us < sa->us);
+}
+
+void load_profiler_report(void) {
+    uint32_t wall_us = (uint32_t)(get_ticks_us() - profiler_start_us);
+    int kept = profiler_count < LOAD_PROFILER_RING ? profiler_count : LOAD_PROFILER_RING;
+    
+    static LoadStep sorted[LOAD_PROFILER_RING];
+    memcpy(sorted, profiler_ring, kept * sizeof(LoadStep));
+    qsort(sorted, kept, sizeof(LoadStep), load_step_compare);
+    
+    uint32_t top_us = 0;
+    for (int i = 0; i < kept; i++) {
+        if (sorted[i].depth == 0) top_us += sorted[i].us;
+    }
+    
+    debugf("LOADPROF scene %s -> %s: %d steps (%d dropped), %.2f ms wall, %.2f ms in top-level steps\n",
+           profiler_from, profiler_to, profiler_count, profiler_count - kept,
+           wall_us / 1000.0f, top_us / 1000.0f);
+    for (int i = 0; i < kept; i++) {
+        const LoadStep* step = &sorted[i];
+        debugf("LOADPROF %8lu us %8lu B %d %-9s %s\n", (unsigned long)step->us, (unsigned long)step->bytes,
+               step->depth, step->kind, step->label);
+    }
+}
+
+#endif // DEBUG
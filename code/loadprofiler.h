@@ -0,0 +1,54 @@
+#ifndef LOADPROFILER_H
+#define LOADPROFILER_H
+
+#include <libdragon.h>
+
+#define LOAD_PROFILER_RING 64           // Steps kept per transition (oldest overwritten)
+#define LOAD_PROFILER_LABEL_MAX 40
+
+// Scene load profiler
+// Asset loads and scene init steps record their wall time and heap growth into a
+// ring buffer. After each transition the scene manager dumps the steps slowest
+// first on the debug channel, one "LOADPROF" line each, which
+// tools/loadprofdiff.py compares between two logs.
+// Steps may nest (a boss init includes its model load), so only top-level steps
+// add up to the transition time.
+// Without DEBUG the report never prints, so every call compiles to nothing.
+
+typedef struct {
+    uint64_t start_us;
+    size_t heap_before;
+    int depth;
+} LoadMark;
+
+#ifdef DEBUG
+
+// Start a new report (clears the ring)
+void load_profiler_begin(const char* from, const char* to);
+
+// Bracket one step: kind groups steps ("model", "skeleton", ...), label names it
+LoadMark load_profiler_mark(void);
+void load_profiler_record(const char* kind, const char* label, LoadMark mark);
+
+// Log the steps since load_profiler_begin, slowest first
+void load_profiler_report(void);
+
+// Profile a statement (assignments only, declarations would not outlive the block)
+#define LOAD_PROFILE(kind, label, ...) do { \
+    LoadMark load_mark_ = load_profiler_mark(); \
+    __VA_ARGS__; \
+    load_profiler_record(kind, label, load_mark_); \
+} while (0)
+
+#else
+
+static inline void load_profiler_begin(const char* from, const char* to) {}
+static inline LoadMark load_profiler_mark(void) { return (LoadMark){0}; }
+static inline void load_profiler_record(const char* kind, const char* label, LoadMark mark) {}
+static inline void load_profiler_report(void) {}
+
+#define LOAD_PROFILE(kind, label, ...) do { __VA_ARGS__; } while (0)
+
+#endif // DEBUG
+
+#endif // LOADPROFILER_H
@@ -0,0 +1,88 @@
+/**
+ * @file matrixring.c
+ * @brief Per-frame uncached matrix ring recycled on RSP syncpoints
+ */
+
+#include "matrixring.h"
+#include "mempolicy.h"
+#include "frameprofiler.h"
+
+typedef struct {
+    T3DMat4FP* matrices;
+    int used;
+    rspq_syncpoint_t sync;
+    bool sync_valid;
+} MatrixRingFrame;
+
+static MatrixRingFrame ring_frames[MATRIX_RING_FRAMES];
+static T3DMat4FP* ring_block = NULL;
+static int ring_current = 0;
+
+void matrix_ring_init(void) {
+    if (ring_block) return;
+    
+    ring_block = mem_alloc_rsp(sizeof(T3DMat4FP) * MATRIX_RING_CAPACITY * MATRIX_RING_FRAMES);
+    if (!ring_block) {
+        debugf("ERROR: Failed to allocate matrix ring\n");
+        return;
+    }
+    
+    for (int i = 0; i < MATRIX_RING_FRAMES; i++) {
+        ring_frames[i].matrices = ring_block + i * MATRIX_RING_CAPACITY;
+        ring_frames[i].used = 0;
+        ring_frames[i].sync_valid = false;
+    }
+    ring_current = 0;
+}
+
+void matrix_ring_cleanup(void) {
+    if (!ring_block) return;
+    
+    rspq_wait();
+    mem_free_rsp(ring_block);
+    ring_block = NULL;
+    for (int i = 0; i < MATRIX_RING_FRAMES; i++) {
+        ring_frames[i].matrices = NULL;
+        ring_frames[i].used = 0;
+        ring_frames[i].sync_valid = false;
+    }
+}
+
+void matrix_ring_begin_frame(void) {
+    if (!ring_block) return;
+    
+    ring_current = (ring_current + 1) % MATRIX_RING_FRAMES;
+    MatrixRingFrame* frame = &ring_frames[ring_current];
+    
+    // Normally long finished; only blocks if the CPU runs a full ring ahead of the RSP
+    if (frame->sync_valid) {
+        rspq_syncpoint_wait(frame->sync);
+        frame->sync_valid = false;
+    }
+    frame->used = 0;
+}
+
+void matrix_ring_end_frame(void) {
+    if (!ring_block) return;
+    
+    MatrixRingFrame* frame = &ring_frames[ring_current];
+    frame->sync = rspq_syncpoint_new();
+    frame->sync_valid = true;
+}
+
+T3DMat4FP* matrix_ring_alloc(void) {
+    MatrixRingFrame* frame = &ring_frames[ring_current];
+    if (frame->used >= MATRIX_RING_CAPACITY) {
+        // Out of matrices: drain the queue so this frame's earlier matrices can be reused
+        debugf("WARNING: Matrix ring full (%d per frame), stalling for the RSP\n", MATRIX_RING_CAPACITY);
+        rspq_wait();
+        frame->used = 0;
+    }
+    return &frame->matrices[frame->used++];
+}
+
+T3DMat4FP* matrix_ring_srt_euler(const float scale[3], const float rotation[3], const float position[3]) {
+    T3DMat4FP* mat;
+    PROF(PROF_MATRICES, mat = matrix_ring_alloc(); t3d_mat4fp_from_srt_euler(mat, scale, rotation, position));
+    return mat;
+}
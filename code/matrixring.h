@@ -0,0 +1,35 @@
+#ifndef MATRIXRING_H
+#define MATRIXRING_H
+
+#include <libdragon.h>
+#include <t3d/t3d.h>
+#include "framepipeline.h"
+
+#define MATRIX_RING_FRAMES FRAME_PIPELINE_DEPTH  // Frame being built plus the ones still in flight
+#define MATRIX_RING_CAPACITY 96     // Matrices per frame: projectiles, enemies, explosions, player, backgrounds
+
+// Per-frame matrix ring
+// Render code takes a fresh uncached matrix for every draw instead of rewriting a
+// persistent one, so the CPU never touches a matrix the RSP may still be reading.
+// A frame's matrices are recycled once the syncpoint recorded after its draw
+// commands has been reached.
+
+// Allocate the ring (call once at startup)
+void matrix_ring_init(void);
+
+// Free the ring after waiting for every frame to finish
+void matrix_ring_cleanup(void);
+
+// Start a frame: wait for the oldest frame to finish on the RSP and reuse its matrices
+void matrix_ring_begin_frame(void);
+
+// End a frame: record a syncpoint covering every matrix handed out since begin
+void matrix_ring_end_frame(void);
+
+// Get a matrix that stays untouched until this frame has been drawn
+T3DMat4FP* matrix_ring_alloc(void);
+
+// Get a matrix built from scale, euler rotation and position
+T3DMat4FP* matrix_ring_srt_euler(const float scale[3], const float rotation[3], const float position[3]);
+
+#endif // MATRIXRING_H
@@ -0,0 +1,47 @@
+/**
+ * @file mempolicy.c
+ * @brief Cached vs uncached placement helpers
+ */
+
+#include "mempolicy.h"
+#include <malloc.h>
+#include <stdint.h>
+
+#define KSEG_MASK  0xE0000000u
+#define KSEG1_BASE 0xA0000000u
+
+void* mem_alloc_cpu(size_t size) {
+    void* ptr = malloc(size);
+    if (!ptr) {
+        debugf("ERROR: Failed to allocate %u bytes of cached memory\n", (unsigned)size);
+    }
+    return ptr;
+}
+
+void mem_free_cpu(void* ptr) {
+    free(ptr);
+}
+
+void* mem_alloc_rsp(size_t size) {
+    void* ptr = malloc_uncached_aligned(16, size);
+    if (!ptr) {
+        debugf("ERROR: Failed to allocate %u bytes of uncached memory\n", (unsigned)size);
+    }
+    return ptr;
+}
+
+void mem_free_rsp(void* ptr) {
+    if (ptr) free_uncached(ptr);
+}
+
+bool mem_is_uncached(const void* ptr) {
+    return ((uint32_t)(uintptr_t)ptr & KSEG_MASK) == KSEG1_BASE;
+}
+
+#ifdef DEBUG
+void mem_check_cached_impl(const void* ptr, const char* what) {
+    if (ptr && mem_is_uncached(ptr)) {
+        debugf("WARNING: %s at %p is in uncached memory, CPU accesses bypass the data cache\n", what, ptr);
+    }
+}
+#endif
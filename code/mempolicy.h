@@ -0,0 +1,33 @@
+#ifndef MEMPOLICY_H
+#define MEMPOLICY_H
+
+#include <libdragon.h>
+#include <stddef.h>
+
+// Memory placement policy:
+// - CPU-only state (skeleton structs, animation state, pose buffers) lives in cached RDRAM.
+//   It is read and written many times per frame and every uncached access stalls the VR4300.
+// - Data the RSP fetches by DMA (T3DMat4FP and friends) lives in uncached memory, so CPU
+//   writes are visible without a writeback. Cached RSP data must be flushed with
+//   data_cache_hit_writeback() before it is used.
+
+// Allocate CPU-only state in cached memory
+void* mem_alloc_cpu(size_t size);
+void mem_free_cpu(void* ptr);
+
+// Allocate RSP-consumed data in 16-byte aligned uncached memory
+void* mem_alloc_rsp(size_t size);
+void mem_free_rsp(void* ptr);
+
+// True if ptr is a KSEG1 (uncached) address
+bool mem_is_uncached(const void* ptr);
+
+#ifdef DEBUG
+void mem_check_cached_impl(const void* ptr, const char* what);
+// Warn when a structure the CPU touches every frame sits in uncached memory
+#define MEM_CHECK_CACHED(ptr, what) mem_check_cached_impl(ptr, what)
+#else
+#define MEM_CHECK_CACHED(ptr, what) ((void)0)
+#endif
+
+#endif // MEMPOLICY_H
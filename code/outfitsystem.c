@@ -15,13 +15,48 @@ static const char* outfit_names[] = {
     "Thrust Mode",
 };
 
-void outfit_system_init(OutfitSystem* outfit_system) {
+static const char** outfit_objects[OUTFIT_COUNT] = {base_objects, thrust_objects};
+static const int* outfit_object_counts[OUTFIT_COUNT] = {&base_object_count, &thrust_object_count};
+
+// Prefix match that accepts variants like "Foot.L", "Foot.R", "Arms_001"
+static bool outfit_name_matches(const char* name, const char* pattern) {
+    size_t pattern_len = strlen(pattern);
+    if (strncmp(name, pattern, pattern_len) != 0) return false;
+    
+    char next_char = name[pattern_len];
+    return next_char == '\0' || next_char == '.' || next_char == '_';
+}
+
+void outfit_system_init(OutfitSystem* outfit_system, const T3DModel* model) {
     if (!outfit_system) return;
     
+    memset(outfit_system, 0, sizeof(OutfitSystem));
     outfit_system->current_outfit = OUTFIT_BASE;
-    outfit_system->initialized = true;
     outfit_system->thrust_timer = 0.0f;
     
+    // Resolve every object to a bit once; the draw filter only tests bits
+    if (model) {
+        T3DModelIter it = t3d_model_iter_create(model, T3D_CHUNK_TYPE_OBJECT);
+        while (t3d_model_iter_next(&it)) {
+            if (outfit_system->object_count >= OUTFIT_MAX_OBJECTS) {
+                debugf("WARNING: Outfit system only tracks %d objects, the rest stay visible\n", OUTFIT_MAX_OBJECTS);
+                break;
+            }
+            int bit = outfit_system->object_count++;
+            outfit_system->objects[bit] = it.object;
+            
+            for (int outfit = 0; outfit < OUTFIT_COUNT; outfit++) {
+                bool visible = !it.object->name;  // Unnamed objects are always shown
+                for (int i = 0; !visible && i < *outfit_object_counts[outfit]; i++) {
+                    visible = outfit_name_matches(it.object->name, outfit_objects[outfit][i]);
+                }
+                if (visible) outfit_system->outfit_masks[outfit] |= (1u << bit);
+            }
+        }
+    }
+    
+    outfit_system->initialized = true;
+    
     debugf("Outfit system initialized - starting with: %s\n", outfit_names[OUTFIT_BASE]);
 }
 
@@ -50,11 +85,6 @@ void outfit_system_cycle_next(OutfitSystem* outfit_system) {
 void outfit_system_update(OutfitSystem* outfit_system, float delta_time) {
     if (!outfit_system || !outfit_system->initialized) return;
     
-    // Validate delta_time
-    if (delta_time <= 0.0f || delta_time != delta_time || delta_time > 1.0f) {
-        return;
-    }
-    
     // Update thrust timer
     if (outfit_system->thrust_timer > 0.0f) {
         outfit_system->thrust_timer -= delta_time;
@@ -90,39 +120,22 @@ const char* outfit_system_get_outfit_name(OutfitType outfit) {
 bool outfit_system_filter_callback(void* userData, const T3DObject *obj) {
     OutfitSystem* outfit_system = (OutfitSystem*)userData;
     
-    if (!outfit_system || !outfit_system->initialized || !obj->name) {
-        return true;  // Show unnamed objects or if system not initialized
+    if (!outfit_system || !outfit_system->initialized || outfit_system->current_outfit >= OUTFIT_COUNT) {
+        return true;  // Show everything if system not initialized or invalid outfit
     }
     
-    const char** current_objects;
-    int object_count;
-    
-    // Select current outfit objects
-    switch (outfit_system->current_outfit) {
-        case OUTFIT_BASE:
-            current_objects = base_objects;
-            object_count = base_object_count;
-            break;
-        case OUTFIT_THRUST:
-            current_objects = thrust_objects;
-            object_count = thrust_object_count;
-            break;
-        default:
-            return true; // Show everything if invalid outfit
-    }
-    
-    // Check if this object should be visible in current outfit
-    // Use prefix matching to support variants like "Foot.L", "Foot.R", etc.
-    for (int i = 0; i < object_count; i++) {
-        size_t pattern_len = strlen(current_objects[i]);
-        if (strncmp(obj->name, current_objects[i], pattern_len) == 0) {
-            // Check if it's an exact match or has a valid suffix (like .L, .R, .001, etc.)
-            char next_char = obj->name[pattern_len];
-            if (next_char == '\0' || next_char == '.' || next_char == '_') {
-                return true;  // Object is part of current outfit
-            }
+    // Objects arrive in model order, so follow them with a cursor and resync if one was skipped
+    int index = outfit_system->draw_cursor;
+    if (index >= outfit_system->object_count || outfit_system->objects[index] != obj) {
+        for (index = 0; index < outfit_system->object_count; index++) {
+            if (outfit_system->objects[index] == obj) break;
+        }
+        if (index == outfit_system->object_count) {
+            outfit_system->draw_cursor = 0;
+            return true;  // Untracked object
         }
     }
+    outfit_system->draw_cursor = (index + 1 < outfit_system->object_count) ? index + 1 : 0;
     
-    return false;  // Object not part of current outfit, hide it
+    return (outfit_system->outfit_masks[outfit_system->current_outfit] >> index) & 1u;
 }
@@ -2,8 +2,11 @@
 #define OUTFITSYSTEM_H
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <t3d/t3dmodel.h>
 
+#define OUTFIT_MAX_OBJECTS 32
+
 // Outfit types for the mecha
 typedef enum {
     OUTFIT_BASE,        // Base mecha: Head, Arms, Body, Foot, LowerLeg, UpperLeg
@@ -16,10 +19,14 @@ typedef struct {
     OutfitType current_outfit;
     bool initialized;
     float thrust_timer;  // Timer for thrust outfit duration (in seconds)
+    const T3DObject* objects[OUTFIT_MAX_OBJECTS];  // Model objects in draw order, bit i = objects[i]
+    int object_count;
+    uint32_t outfit_masks[OUTFIT_COUNT];  // Visible objects per outfit, resolved at init
+    int draw_cursor;     // Expected index of the next object passed to the filter
 } OutfitSystem;
 
-// Initialize the outfit system
-void outfit_system_init(OutfitSystem* outfit_system);
+// Initialize the outfit system and resolve the model's objects into per-outfit masks
+void outfit_system_init(OutfitSystem* outfit_system, const T3DModel* model);
 
 // Set a specific outfit
 void outfit_system_set_outfit(OutfitSystem* outfit_system, OutfitType outfit);
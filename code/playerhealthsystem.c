@@ -1,4 +1,5 @@
 #include "playerhealthsystem.h"
+#include "assetcache.h"
 
 void player_health_init(PlayerHealthSystem* system, CollisionSystem* collision_system) {
     // Initialize player health from PLAYER collision box name
@@ -11,23 +12,27 @@ void player_health_init(PlayerHealthSystem* system, CollisionSystem* collision_s
             break;
         }
     }
-    system->health = system->max_health;
-    system->is_dead = false;
-    system->hit_display_timer = 0.0f;
-    system->show_hit = false;
-    system->flash_timer = 0.0f;
     system->flash_duration = 0.15f;  // Flash for 150ms
-    system->death_timer = 0.0f;
+    player_health_reset(system);
     
     debugf("Player initialized with %d health\n", system->health);
     
     // Load health sprite
-    system->health_sprite = sprite_load("rom:/health.sprite");
+    system->health_sprite = asset_cache_get_sprite(PLAYER_HEALTH_SPRITE_PATH);
     if (!system->health_sprite) {
         debugf("WARNING: Failed to load health sprite\n");
     }
 }
 
+void player_health_reset(PlayerHealthSystem* system) {
+    system->health = system->max_health;
+    system->is_dead = false;
+    system->hit_display_timer = 0.0f;
+    system->show_hit = false;
+    system->flash_timer = 0.0f;
+    system->death_timer = 0.0f;
+}
+
 bool player_health_take_damage(PlayerHealthSystem* system, int damage) {
     if (system->is_dead) return false;
     
@@ -114,7 +119,7 @@ bool player_health_is_flashing(PlayerHealthSystem* system) {
 
 void player_health_cleanup(PlayerHealthSystem* system) {
     if (system->health_sprite) {
-        sprite_free(system->health_sprite);
+        asset_cache_release(system->health_sprite);
         system->health_sprite = NULL;
     }
 }
@@ -5,6 +5,8 @@
 #include <stdbool.h>
 #include "collisionsystem.h"
 
+#define PLAYER_HEALTH_SPRITE_PATH "rom:/health.sprite"
+
 typedef struct {
     int health;
     int max_health;
@@ -23,6 +25,11 @@ typedef struct {
  */
 void player_health_init(PlayerHealthSystem* system, CollisionSystem* collision_system);
 
+/**
+ * Restore full health and clear hit/death state (keeps the health sprite)
+ */
+void player_health_reset(PlayerHealthSystem* system);
+
 /**
  * Take damage and update health
  * Returns true if player died from this hit
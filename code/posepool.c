@@ -0,0 +1,60 @@
+/**
+ * @file posepool.c
+ * @brief Shared pool of lightweight pose buffers for blending and layers
+ */
+
+#include "posepool.h"
+#include <string.h>
+
+typedef struct {
+    T3DSkeleton pose;
+    T3DBone bones[POSE_MAX_BONES];
+    bool in_use;
+} PoseSlot;
+
+static PoseSlot pose_pool[POSE_POOL_SIZE];
+
+T3DSkeleton* pose_pool_acquire(const T3DSkeleton* base) {
+    if (!base || !base->skeletonRef) return NULL;
+    
+    int bone_count = base->skeletonRef->boneCount;
+    if (bone_count > POSE_MAX_BONES) {
+        debugf("ERROR: Skeleton has %d bones, pose buffers hold %d\n", bone_count, POSE_MAX_BONES);
+        return NULL;
+    }
+    
+    for (int i = 0; i < POSE_POOL_SIZE; i++) {
+        PoseSlot* slot = &pose_pool[i];
+        if (slot->in_use) continue;
+        
+        memset(&slot->pose, 0, sizeof(T3DSkeleton));
+        slot->pose.skeletonRef = base->skeletonRef;
+        slot->pose.bones = slot->bones;
+        slot->pose.boneMatricesFP = NULL;
+        memcpy(slot->bones, base->bones, sizeof(T3DBone) * bone_count);
+        slot->in_use = true;
+        return &slot->pose;
+    }
+    
+    debugf("WARNING: Pose pool exhausted\n");
+    return NULL;
+}
+
+void pose_pool_release(T3DSkeleton* pose) {
+    if (!pose) return;
+    
+    for (int i = 0; i < POSE_POOL_SIZE; i++) {
+        if (&pose_pool[i].pose == pose) {
+            pose_pool[i].in_use = false;
+            return;
+        }
+    }
+}
+
+int pose_pool_get_free_count(void) {
+    int count = 0;
+    for (int i = 0; i < POSE_POOL_SIZE; i++) {
+        if (!pose_pool[i].in_use) count++;
+    }
+    return count;
+}
@@ -0,0 +1,22 @@
+#ifndef POSEPOOL_H
+#define POSEPOOL_H
+
+#include <libdragon.h>
+#include <t3d/t3d.h>
+#include <t3d/t3dskeleton.h>
+
+#define POSE_POOL_SIZE 6
+#define POSE_MAX_BONES 32
+
+// Borrow a pose buffer shaped like base, starting from its current local pose.
+// Pose buffers hold local bone transforms only (no matrices) and live in cached RAM,
+// so they can be animated and blended but never drawn directly.
+T3DSkeleton* pose_pool_acquire(const T3DSkeleton* base);
+
+// Return a pose buffer to the pool
+void pose_pool_release(T3DSkeleton* pose);
+
+// Number of unused pose buffers
+int pose_pool_get_free_count(void);
+
+#endif // POSEPOOL_H
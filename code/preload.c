@@ -0,0 +1,117 @@
+/**
+ * @file preload.c
+ * @brief Time-boxed background loading of the next scene's assets
+ */
+
+#include "preload.h"
+#include "assetcache.h"
+#include "assetstream.h"
+#include <string.h>
+
+typedef struct {
+    const char* path;           // ROM path, must outlive the queue (string literal or ROM table)
+    bool is_sprite;
+    const void* asset;          // Cache reference held until release
+    bool done;
+} PreloadItem;
+
+static PreloadItem preload_items[PRELOAD_QUEUE_MAX];
+static int preload_count = 0;
+static int preload_next = 0;
+static uint64_t preload_spent_us = 0;
+static AssetStream preload_stream;     // Decompression of preload_items[preload_next] in progress
+static bool preload_streaming = false;
+
+static void preload_queue_add(const char* path, bool is_sprite) {
+    if (!path) return;
+    
+    for (int i = 0; i < preload_count; i++) {
+        if (preload_items[i].is_sprite == is_sprite && strcmp(preload_items[i].path, path) == 0) return;
+    }
+    if (preload_count >= PRELOAD_QUEUE_MAX) {
+        debugf("WARNING: Preload queue full, %s will load with its scene\n", path);
+        return;
+    }
+    
+    preload_items[preload_count++] = (PreloadItem){ .path = path, .is_sprite = is_sprite };
+}
+
+void preload_queue_add_model(const char* path) {
+    preload_queue_add(path, false);
+}
+
+void preload_queue_add_sprite(const char* path) {
+    preload_queue_add(path, true);
+}
+
+static const void* preload_load(const PreloadItem* item) {
+    return item->is_sprite ? (const void*)asset_cache_get_sprite(item->path)
+                           : (const void*)asset_cache_get_model(item->path);
+}
+
+bool preload_queue_step(uint32_t budget_us) {
+    uint64_t start_us = get_ticks_us();
+    int first = preload_next;
+    
+    while (preload_next < preload_count) {
+        uint32_t elapsed_us = (uint32_t)(get_ticks_us() - start_us);
+        if (elapsed_us >= budget_us) break;
+        
+        PreloadItem* item = &preload_items[preload_next];
+        if (!preload_streaming) {
+            if (asset_cache_is_resident(item->path) || !asset_stream_open(&preload_stream, item->path)) {
+                // Already cached, or a file that cannot be streamed: load it in one go
+                item->asset = preload_load(item);
+                item->done = true;
+                preload_next++;
+                continue;
+            }
+            preload_streaming = true;
+        }
+        
+        // Large assets decompress across several frames
+        if (!asset_stream_step(&preload_stream, budget_us - elapsed_us)) break;
+        preload_streaming = false;
+        
+        int size = 0;
+        void* image = asset_stream_take(&preload_stream, &size);
+        if (image) {
+            item->asset = item->is_sprite
+                ? (const void*)asset_cache_get_sprite_from(item->path, image, size, preload_stream.busy_us)
+                : (const void*)asset_cache_get_model_from(item->path, image, size, preload_stream.busy_us);
+        } else {
+            item->asset = preload_load(item);
+        }
+        item->done = true;
+        preload_next++;
+    }
+    
+    preload_spent_us += get_ticks_us() - start_us;
+    if (first < preload_count && preload_next == preload_count) {
+        debugf("Preload: %d assets ready after %.2f ms of background loading\n",
+               preload_count, preload_spent_us / 1000.0f);
+        asset_stream_report();
+    }
+    return preload_next == preload_count;
+}
+
+void preload_queue_release(void) {
+    if (preload_streaming) {
+        asset_stream_close(&preload_stream);
+        preload_streaming = false;
+    }
+    
+    int loaded = 0;
+    for (int i = 0; i < preload_count; i++) {
+        if (!preload_items[i].done) continue;
+        asset_cache_release(preload_items[i].asset);
+        loaded++;
+    }
+    
+    if (preload_count > 0) {
+        debugf("Preload: handed over %d/%d assets\n", loaded, preload_count);
+    }
+    preload_count = 0;
+    preload_next = 0;
+    preload_spent_us = 0;
+}
@@ -0,0 +1,28 @@
+#ifndef PRELOAD_H
+#define PRELOAD_H
+
+#include <libdragon.h>
+
+#define PRELOAD_QUEUE_MAX 24
+#define PRELOAD_FRAME_BUDGET_US 4000   // Loading time per frame during idle scenes
+
+// Background preload queue
+// Idle scenes (startup logos, intro waiting for Start) feed the next scene's
+// models and sprites into the asset cache a few at a time. The queue holds a
+// cache reference on each loaded asset until preload_queue_release(), which
+// main.c calls once the scene that uses them has acquired its own.
+// Compressed assets are decompressed in chunks (assetstream.h), so a large model
+// is spread over several frames; the budget overshoots by at most one chunk plus
+// building the model or sprite from its decompressed image.
+
+// Queue an asset for loading (duplicates and overflow are ignored)
+void preload_queue_add_model(const char* path);
+void preload_queue_add_sprite(const char* path);
+
+// Load queued assets until budget_us has been spent; true once everything is loaded
+bool preload_queue_step(uint32_t budget_us);
+
+// Drop the queue's references and clear it (anything not yet loaded is skipped)
+void preload_queue_release(void);
+
+#endif // PRELOAD_H
@@ -1,4 +1,7 @@
 #include "projectilesystem.h"
+#include "matrixring.h"
+#include "simclock.h"
+#include "assetcache.h"
 #include <string.h>
 #include <math.h>
 
@@ -18,41 +21,43 @@ void projectile_system_init(ProjectileSystem* ps, float speed, float lifetime, f
     ps->cooldown_timers[PROJECTILE_SLASH] = 0.0f;
     
     // Load projectile models
-    ps->projectile_models[PROJECTILE_NORMAL] = t3d_model_load("rom:/playerproj.t3dm");
+    ps->projectile_models[PROJECTILE_NORMAL] = asset_cache_get_model(PROJECTILE_NORMAL_MODEL_PATH);
     if (!ps->projectile_models[PROJECTILE_NORMAL]) {
         debugf("WARNING: Failed to load playerproj model\n");
     } else {
         debugf("Successfully loaded playerproj model\n");
     }
     
-    ps->projectile_models[PROJECTILE_SLASH] = t3d_model_load("rom:/slash.t3dm");
+    ps->projectile_models[PROJECTILE_SLASH] = asset_cache_get_model(PROJECTILE_SLASH_MODEL_PATH);
     if (!ps->projectile_models[PROJECTILE_SLASH]) {
         debugf("WARNING: Failed to load slash model\n");
     } else {
         debugf("Successfully loaded slash model\n");
     }
     
-    ps->projectile_models[PROJECTILE_ENEMY] = t3d_model_load("rom:/enemyproj1.t3dm");
+    ps->projectile_models[PROJECTILE_ENEMY] = asset_cache_get_model(PROJECTILE_ENEMY_MODEL_PATH);
     if (!ps->projectile_models[PROJECTILE_ENEMY]) {
         debugf("WARNING: Failed to load enemyproj1 model\n");
     } else {
         debugf("Successfully loaded enemyproj1 model\n");
     }
     
-    // Allocate matrices for each projectile
+    // Matrices are built per frame at render time (see matrixring.h)
+    ps->initialized = true;
+    projectile_system_reset(ps);
+    debugf("Projectile system initialized\n");
+}
+
+void projectile_system_reset(ProjectileSystem* ps) {
+    if (!ps || !ps->initialized) return;
+    
     for (int i = 0; i < MAX_PROJECTILES; i++) {
-        ps->projectile_matrices[i] = malloc_uncached(sizeof(T3DMat4FP));
-        // Initialize all projectiles off-screen
-        float offscreen[3] = {10000.0f, 10000.0f, 10000.0f};
-        float scale[3] = {0.0f, 0.0f, 0.0f};
-        float rotation[3] = {0.0f, 0.0f, 0.0f};
-        t3d_mat4fp_from_srt_euler(ps->projectile_matrices[i], scale, rotation, offscreen);
         ps->projectiles[i].active = false;
         ps->projectiles[i].position = (T3DVec3){{10000.0f, 10000.0f, 10000.0f}};
     }
-    
-    ps->initialized = true;
-    debugf("Projectile system initialized\n");
+    for (int i = 0; i < PROJECTILE_TYPE_COUNT; i++) {
+        ps->cooldown_timers[i] = 0.0f;
+    }
 }
 
 void projectile_system_cleanup(ProjectileSystem* ps) {
@@ -60,18 +65,11 @@ void projectile_system_cleanup(ProjectileSystem* ps) {
     
     for (int i = 0; i < PROJECTILE_TYPE_COUNT; i++) {
         if (ps->projectile_models[i]) {
-            t3d_model_free(ps->projectile_models[i]);
+            asset_cache_release(ps->projectile_models[i]);
             ps->projectile_models[i] = NULL;
         }
     }
     
-    for (int i = 0; i < MAX_PROJECTILES; i++) {
-        if (ps->projectile_matrices[i]) {
-            free_uncached(ps->projectile_matrices[i]);
-            ps->projectile_matrices[i] = NULL;
-        }
-    }
-    
     ps->initialized = false;
     debugf("Projectile system cleaned up\n");
 }
@@ -87,6 +85,7 @@ void projectile_system_spawn(ProjectileSystem* ps, T3DVec3 position, T3DVec3 dir
     for (int i = 0; i < MAX_PROJECTILES; i++) {
         if (!ps->projectiles[i].active) {
             ps->projectiles[i].position = position;
+            ps->projectiles[i].prev_position = position;
             ps->projectiles[i].type = type;
             
             // Normalize direction and apply speed
@@ -124,12 +123,6 @@ void projectile_system_spawn(ProjectileSystem* ps, T3DVec3 position, T3DVec3 dir
                 ps->cooldown_timers[type] = ps->shoot_cooldowns[type];
             }
             
-            // Initialize matrix immediately for rendering
-            float scale[3] = {1.0f, 1.0f, 1.0f};
-            float rotation[3] = {0.0f, 0.0f, 0.0f};
-            float pos[3] = {position.v[0], position.v[1], position.v[2]};
-            t3d_mat4fp_from_srt_euler(ps->projectile_matrices[i], scale, rotation, pos);
-            
             debugf("Spawned projectile at (%.1f, %.1f, %.1f)\n", 
                    position.v[0], position.v[1], position.v[2]);
             return;
@@ -139,6 +132,54 @@ void projectile_system_spawn(ProjectileSystem* ps, T3DVec3 position, T3DVec3 dir
     debugf("WARNING: No available projectile slots\n");
 }
 
+int projectile_system_spawn_batch(ProjectileSystem* ps, const T3DVec3* origin, const T3DVec3* offsets,
+                                  const T3DVec3* directions, int count, ProjectileType type) {
+    if (!ps || !ps->initialized || !origin || !directions) return 0;
+    if (type >= PROJECTILE_TYPE_COUNT) return 0;
+    if (ps->cooldown_timers[type] > 0.0f) return 0;
+    
+    // Directions come from precomputed unit tables, so no normalization here
+    int damage = (type == PROJECTILE_SLASH) ? 3 : 1;
+    bool is_enemy = (type == PROJECTILE_ENEMY);
+    float speed = ps->projectile_speed;
+    
+    int spawned = 0;
+    int slot = 0;
+    while (spawned < count) {
+        while (slot < MAX_PROJECTILES && ps->projectiles[slot].active) slot++;
+        if (slot >= MAX_PROJECTILES) break;
+        
+        Projectile* p = &ps->projectiles[slot];
+        const T3DVec3* dir = &directions[spawned];
+        
+        p->position = *origin;
+        if (offsets) {
+            p->position.v[0] += offsets[spawned].v[0];
+            p->position.v[1] += offsets[spawned].v[1];
+            p->position.v[2] += offsets[spawned].v[2];
+        }
+        p->prev_position = p->position;
+        p->velocity = (T3DVec3){{dir->v[0] * speed, dir->v[1] * speed, dir->v[2] * speed}};
+        p->lifetime = ps->projectile_lifetime;
+        p->type = type;
+        p->damage = damage;
+        p->is_enemy = is_enemy;
+        p->active = true;
+        
+        spawned++;
+        slot++;
+    }
+    
+    if (spawned > 0 && type != PROJECTILE_ENEMY) {
+        ps->cooldown_timers[type] = ps->shoot_cooldowns[type];
+    }
+    
+    if (spawned < count) {
+        debugf("WARNING: Projectile batch truncated (%d of %d)\n", spawned, count);
+    }
+    return spawned;
+}
+
 void projectile_system_update(ProjectileSystem* ps, float delta_time) {
     if (!ps || !ps->initialized) return;
     
@@ -156,6 +197,7 @@ void projectile_system_update(ProjectileSystem* ps, float delta_time) {
     for (int i = 0; i < MAX_PROJECTILES; i++) {
         if (ps->projectiles[i].active) {
             // Update position
+            ps->projectiles[i].prev_position = ps->projectiles[i].position;
             ps->projectiles[i].position.v[0] += ps->projectiles[i].velocity.v[0] * delta_time;
             ps->projectiles[i].position.v[1] += ps->projectiles[i].velocity.v[1] * delta_time;
             ps->projectiles[i].position.v[2] += ps->projectiles[i].velocity.v[2] * delta_time;
@@ -167,19 +209,6 @@ void projectile_system_update(ProjectileSystem* ps, float delta_time) {
             if (ps->projectiles[i].lifetime <= 0.0f) {
                 ps->projectiles[i].active = false;
             }
-            
-            // Update matrix for rendering
-            if (ps->projectiles[i].active) {
-                float scale[3] = {1.0f, 1.0f, 1.0f};
-                float rotation[3] = {0.0f, 0.0f, 0.0f};
-                float position[3] = {
-                    ps->projectiles[i].position.v[0],
-                    ps->projectiles[i].position.v[1],
-                    ps->projectiles[i].position.v[2]
-                };
-                
-                t3d_mat4fp_from_srt_euler(ps->projectile_matrices[i], scale, rotation, position);
-            }
         }
     }
 }
@@ -201,6 +230,7 @@ void projectile_system_update_with_collision(ProjectileSystem* ps, float delta_t
     for (int i = 0; i < MAX_PROJECTILES; i++) {
         if (ps->projectiles[i].active) {
             // Update position
+            ps->projectiles[i].prev_position = ps->projectiles[i].position;
             ps->projectiles[i].position.v[0] += ps->projectiles[i].velocity.v[0] * delta_time;
             ps->projectiles[i].position.v[1] += ps->projectiles[i].velocity.v[1] * delta_time;
             ps->projectiles[i].position.v[2] += ps->projectiles[i].velocity.v[2] * delta_time;
@@ -217,11 +247,6 @@ void projectile_system_update_with_collision(ProjectileSystem* ps, float delta_t
                         g_last_damage_dealt = ps->projectiles[i].damage;  // Store damage for enemy system
                     }
                     ps->projectiles[i].active = false;
-                    // Move projectile far off-screen when deactivated
-                    float offscreen[3] = {10000.0f, 10000.0f, 10000.0f};
-                    float scale[3] = {0.0f, 0.0f, 0.0f};
-                    float rotation[3] = {0.0f, 0.0f, 0.0f};
-                    t3d_mat4fp_from_srt_euler(ps->projectile_matrices[i], scale, rotation, offscreen);
                     continue;
                 }
                 
@@ -232,11 +257,6 @@ void projectile_system_update_with_collision(ProjectileSystem* ps, float delta_t
                         *player_timer = 2.0f;  // Show for 2 seconds
                     }
                     ps->projectiles[i].active = false;
-                    // Move projectile far off-screen when deactivated
-                    float offscreen[3] = {10000.0f, 10000.0f, 10000.0f};
-                    float scale[3] = {0.0f, 0.0f, 0.0f};
-                    float rotation[3] = {0.0f, 0.0f, 0.0f};
-                    t3d_mat4fp_from_srt_euler(ps->projectile_matrices[i], scale, rotation, offscreen);
                     continue;
                 }
             }
@@ -247,37 +267,26 @@ void projectile_system_update_with_collision(ProjectileSystem* ps, float delta_t
             // Deactivate if lifetime expired
             if (ps->projectiles[i].lifetime <= 0.0f) {
                 ps->projectiles[i].active = false;
-                // Move projectile far off-screen when deactivated
-                float offscreen[3] = {10000.0f, 10000.0f, 10000.0f};
-                float scale[3] = {0.0f, 0.0f, 0.0f};
-                float rotation[3] = {0.0f, 0.0f, 0.0f};
-                t3d_mat4fp_from_srt_euler(ps->projectile_matrices[i], scale, rotation, offscreen);
-                continue;
             }
-            
-            // Update matrix for rendering (only for active projectiles that didn't hit)
-            float scale[3] = {1.0f, 1.0f, 1.0f};
-            float rotation[3] = {0.0f, 0.0f, 0.0f};
-            float position[3] = {
-                ps->projectiles[i].position.v[0],
-                ps->projectiles[i].position.v[1],
-                ps->projectiles[i].position.v[2]
-            };
-            t3d_mat4fp_from_srt_euler(ps->projectile_matrices[i], scale, rotation, position);
         }
     }
 }
 
-void projectile_system_render(ProjectileSystem* ps) {
+void projectile_system_render(ProjectileSystem* ps, float alpha) {
     if (!ps || !ps->initialized) return;
     
-    // Render all active projectiles
+    float scale[3] = {1.0f, 1.0f, 1.0f};
+    float rotation[3] = {0.0f, 0.0f, 0.0f};
+    
+    // Render all active projectiles, each with a fresh matrix for this frame
     for (int i = 0; i < MAX_PROJECTILES; i++) {
         if (ps->projectiles[i].active) {
             T3DModel* model = ps->projectile_models[ps->projectiles[i].type];
             if (!model) continue;
             
-            t3d_matrix_push(ps->projectile_matrices[i]);
+            T3DVec3 pos = sim_lerp_vec3(&ps->projectiles[i].prev_position, &ps->projectiles[i].position, alpha);
+            float position[3] = {pos.v[0], pos.v[1], pos.v[2]};
+            t3d_matrix_push(matrix_ring_srt_euler(scale, rotation, position));
             
             T3DModelDrawConf drawConf = {
                 .userData = NULL,
@@ -308,11 +317,6 @@ void projectile_system_deactivate(ProjectileSystem* ps, int index) {
     if (!ps || !ps->initialized || index < 0 || index >= MAX_PROJECTILES) return;
     
     ps->projectiles[index].active = false;
-    // Move projectile far off-screen
-    float offscreen[3] = {10000.0f, 10000.0f, 10000.0f};
-    float scale[3] = {0.0f, 0.0f, 0.0f};
-    float rotation[3] = {0.0f, 0.0f, 0.0f};
-    t3d_mat4fp_from_srt_euler(ps->projectile_matrices[index], scale, rotation, offscreen);
 }
 
 int projectile_system_get_last_damage(void) {
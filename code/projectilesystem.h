@@ -9,6 +9,11 @@
 
 #define MAX_PROJECTILES 32
 
+// Projectile models (also queued by the level preloader)
+#define PROJECTILE_NORMAL_MODEL_PATH "rom:/playerproj.t3dm"
+#define PROJECTILE_SLASH_MODEL_PATH "rom:/slash.t3dm"
+#define PROJECTILE_ENEMY_MODEL_PATH "rom:/enemyproj1.t3dm"
+
 // Projectile types
 typedef enum {
     PROJECTILE_NORMAL,
@@ -20,6 +25,7 @@ typedef enum {
 // Individual projectile
 typedef struct {
     T3DVec3 position;
+    T3DVec3 prev_position;  // Position one simulation tick earlier, for interpolation
     T3DVec3 velocity;
     float lifetime;
     bool active;
@@ -32,7 +38,6 @@ typedef struct {
 typedef struct {
     Projectile projectiles[MAX_PROJECTILES];
     T3DModel* projectile_models[PROJECTILE_TYPE_COUNT];
-    T3DMat4FP* projectile_matrices[MAX_PROJECTILES];
     
     float projectile_speed;
     float projectile_lifetime;
@@ -45,20 +50,28 @@ typedef struct {
 // Initialize the projectile system
 void projectile_system_init(ProjectileSystem* ps, float speed, float lifetime, float normal_cooldown, float slash_cooldown);
 
+// Deactivate every projectile and clear cooldowns (models stay loaded)
+void projectile_system_reset(ProjectileSystem* ps);
+
 // Cleanup the projectile system
 void projectile_system_cleanup(ProjectileSystem* ps);
 
 // Spawn a new projectile from a position with a direction and type
 void projectile_system_spawn(ProjectileSystem* ps, T3DVec3 position, T3DVec3 direction, ProjectileType type);
 
+// Spawn a batch of projectiles from unit directions (offsets may be NULL)
+// Returns the number of projectiles actually spawned
+int projectile_system_spawn_batch(ProjectileSystem* ps, const T3DVec3* origin, const T3DVec3* offsets,
+                                  const T3DVec3* directions, int count, ProjectileType type);
+
 // Update all projectiles
 void projectile_system_update(ProjectileSystem* ps, float delta_time);
 
 // Update all projectiles with collision checking
 void projectile_system_update_with_collision(ProjectileSystem* ps, float delta_time, CollisionSystem* collision, bool* enemy_hit, bool* player_hit, float* enemy_timer, float* player_timer);
 
-// Render all projectiles
-void projectile_system_render(ProjectileSystem* ps);
+// Render all projectiles, blended between the last two ticks by alpha (see simclock.h)
+void projectile_system_render(ProjectileSystem* ps, float alpha);
 
 // Get projectile at index for manual collision checking
 Projectile* projectile_system_get_projectile(ProjectileSystem* ps, int index);
@@ -0,0 +1,237 @@
+/**
+ * @file scenemanager.c
+ * @brief Scene registry, per-scene arena and transition handling
+ */
+
+#include "scenemanager.h"
+#include "startup.h"
+#include "intro.h"
+#include "level.h"
+#include "end.h"
+#include "assetcache.h"
+#include "preload.h"
+#include "assetstream.h"
+#include "loadprofiler.h"
+#include "mempolicy.h"
+#include <string.h>
+
+// Adapters from the typed scene functions to the vtable signatures
+#define SCENE_ADAPTERS(prefix, Type) \
+    static int prefix##_scene_update(void* state, float dt) { return prefix##_update((Type*)state, dt); } \
+    static void prefix##_scene_cleanup(void* state) { prefix##_cleanup((Type*)state); }
+
+// Scenes with nothing moving fast enough to need interpolation ignore alpha
+#define SCENE_RENDER_ADAPTER(prefix, Type) \
+    static void prefix##_scene_render(void* state, float alpha) { (void)alpha; prefix##_render((Type*)state); }
+
+#define SCENE_INIT_ADAPTER(prefix, Type) \
+    static void prefix##_scene_init(void* state, GameScene id, rdpq_font_t* font) { (void)id; prefix##_init((Type*)state, font); }
+
+SCENE_ADAPTERS(startup, SceneStartup)
+SCENE_ADAPTERS(intro, SceneIntro)
+SCENE_ADAPTERS(level, Level)
+SCENE_ADAPTERS(end, SceneEnd)
+SCENE_INIT_ADAPTER(startup, SceneStartup)
+SCENE_INIT_ADAPTER(intro, SceneIntro)
+SCENE_INIT_ADAPTER(end, SceneEnd)
+SCENE_RENDER_ADAPTER(startup, SceneStartup)
+SCENE_RENDER_ADAPTER(intro, SceneIntro)
+SCENE_RENDER_ADAPTER(end, SceneEnd)
+
+static void intro_scene_preload(GameScene id) {
+    (void)id;
+    intro_queue_preload();
+}
+
+static void level_scene_preload(GameScene id) {
+    level_queue_preload(level_desc_get(id));
+}
+
+static void level_scene_render(void* state, float alpha) {
+    level_render((Level*)state, alpha);
+}
+
+static void level_scene_suspend(void* state) {
+    level_suspend((Level*)state);
+}
+
+static void level_scene_resume(void* state) {
+    level_resume((Level*)state);
+}
+
+// Levels share one runtime; the scene id picks the description
+static void level_scene_init(void* state, GameScene id, rdpq_font_t* font) {
+    level_init((Level*)state, level_desc_get(id), font);
+}
+
+#define LEVEL_SCENE(id, next) { \
+    .name = #id, \
+    .state_size = sizeof(Level), \
+    .init = level_scene_init, \
+    .update = level_scene_update, \
+    .render = level_scene_render, \
+    .cleanup = level_scene_cleanup, \
+    .preload = level_scene_preload, \
+    .suspend = level_scene_suspend, \
+    .resume = level_scene_resume, \
+    .idle = false, \
+    .expected_next = next \
+}
+
+static const SceneVTable scene_table[SCENE_COUNT] = {
+    [SCENE_STARTUP] = {
+        .name = "STARTUP",
+        .state_size = sizeof(SceneStartup),
+        .init = startup_scene_init,
+        .update = startup_scene_update,
+        .render = startup_scene_render,
+        .cleanup = startup_scene_cleanup,
+        .idle = true,
+        .expected_next = SCENE_INTRO
+    },
+    [SCENE_INTRO] = {
+        .name = "INTRO",
+        .state_size = sizeof(SceneIntro),
+        .init = intro_scene_init,
+        .update = intro_scene_update,
+        .render = intro_scene_render,
+        .cleanup = intro_scene_cleanup,
+        .preload = intro_scene_preload,
+        .idle = true,
+        .expected_next = LEVEL_1
+    },
+    [LEVEL_1] = LEVEL_SCENE(LEVEL_1, LEVEL_2),
+    [LEVEL_2] = LEVEL_SCENE(LEVEL_2, LEVEL_3),
+    [LEVEL_3] = LEVEL_SCENE(LEVEL_3, LEVEL_4),
+    [LEVEL_4] = LEVEL_SCENE(LEVEL_4, LEVEL_5),
+    [LEVEL_5] = LEVEL_SCENE(LEVEL_5, SCENE_END),
+    [SCENE_END] = {
+        .name = "END",
+        .state_size = sizeof(SceneEnd),
+        .init = end_scene_init,
+        .update = end_scene_update,
+        .render = end_scene_render,
+        .cleanup = end_scene_cleanup,
+        .idle = false,
+        .expected_next = SCENE_COUNT
+    }
+};
+
+static GameScene scene_current = SCENE_COUNT;
+static const SceneVTable* scene_vt = NULL;
+static void* scene_arena = NULL;
+static rdpq_font_t* scene_font = NULL;
+
+const SceneVTable* scene_get_vtable(GameScene id) {
+    if (id < 0 || id >= SCENE_COUNT) return NULL;
+    return &scene_table[id];
+}
+
+static void scene_enter(GameScene id) {
+    const SceneVTable* vt = &scene_table[id];
+    
+    scene_arena = mem_alloc_cpu(vt->state_size);
+    if (!scene_arena) {
+        debugf("ERROR: Failed to allocate %u bytes for scene %s\n", (unsigned)vt->state_size, vt->name);
+        scene_vt = NULL;
+        return;
+    }
+    memset(scene_arena, 0, vt->state_size);
+    
+    scene_current = id;
+    scene_vt = vt;
+    vt->init(scene_arena, id, scene_font);
+    
+    if (vt->idle) {
+        // Load what comes next while this scene leaves the CPU free
+        const SceneVTable* next = scene_get_vtable(vt->expected_next);
+        if (next && next->preload) next->preload(vt->expected_next);
+    } else {
+        // The scene holds its own references now
+        preload_queue_release();
+    }
+    
+    if (vt->resume) vt->resume(scene_arena);
+}
+
+static void scene_leave(void) {
+    if (!scene_vt) return;
+    
+    scene_vt->cleanup(scene_arena);
+    mem_free_cpu(scene_arena);
+    scene_arena = NULL;
+    scene_vt = NULL;
+}
+
+static void scene_transition(GameScene next) {
+    const char* from = scene_vt ? scene_vt->name : "none";
+    if (scene_vt && scene_vt->suspend) scene_vt->suspend(scene_arena);
+    
+    // Frames still in flight may reference the scene's models and buffers
+    rspq_wait();
+    asset_cache_begin_transition();
+    
+    load_profiler_begin(from, scene_table[next].name);
+    uint64_t start_us = get_ticks_us();
+    LOAD_PROFILE("cleanup", from, scene_leave());
+    uint64_t cleanup_us = get_ticks_us();
+    LOAD_PROFILE("init", scene_table[next].name, scene_enter(next));
+    uint64_t init_us = get_ticks_us();
+    
+    asset_cache_end_transition();
+    debugf("Scene %s -> %s: cleanup %.2f ms, init %.2f ms\n", from, scene_table[next].name,
+           (cleanup_us - start_us) / 1000.0f, (init_us - cleanup_us) / 1000.0f);
+#ifdef DEBUG
+    asset_stream_report();
+    load_profiler_report();
+#endif
+}
+
+void scene_manager_init(GameScene first, rdpq_font_t* font) {
+    scene_font = font;
+    if (!scene_get_vtable(first)) {
+        debugf("WARNING: Invalid start scene %d, using startup\n", first);
+        first = SCENE_STARTUP;
+    }
+    load_profiler_begin(NULL, scene_table[first].name);
+    LOAD_PROFILE("init", scene_table[first].name, scene_enter(first));
+#ifdef DEBUG
+    load_profiler_report();
+#endif
+}
+
+bool scene_manager_update(float dt) {
+    if (!scene_vt) return false;
+    
+    int next = scene_vt->update(scene_arena, dt);
+    if (next < 0) return false;
+    
+    if (!scene_get_vtable((GameScene)next)) {
+        debugf("WARNING: Scene %s requested invalid scene %d\n", scene_vt->name, next);
+        return false;
+    }
+    scene_transition((GameScene)next);
+    return true;
+}
+
+void scene_manager_idle(void) {
+    // Spend idle frames loading the next scene's assets
+    if (scene_vt && scene_vt->idle) {
+        preload_queue_step(PRELOAD_FRAME_BUDGET_US);
+    }
+}
+
+void scene_manager_render(float alpha) {
+    if (!scene_vt) return;
+    scene_vt->render(scene_arena, alpha);
+}
+
+void scene_manager_shutdown(void) {
+    rspq_wait();
+    scene_leave();
+    scene_current = SCENE_COUNT;
+}
+
+GameScene scene_manager_current(void) {
+    return scene_current;
+}
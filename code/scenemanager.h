@@ -0,0 +1,45 @@
+#ifndef SCENEMANAGER_H
+#define SCENEMANAGER_H
+
+#include <libdragon.h>
+#include "scenes.h"
+
+// Per-scene entry points
+// Every scene's state lives in a single arena allocated on entry and freed on exit,
+// so only the active scene occupies RAM.
+typedef struct {
+    const char* name;
+    size_t state_size;                                          // Bytes of arena the scene needs
+    void (*init)(void* state, GameScene id, rdpq_font_t* font);
+    int (*update)(void* state, float dt);                       // One fixed tick: next scene, or -1 to stay
+    void (*render)(void* state, float alpha);                   // alpha: 0-1 between the last two ticks
+    void (*cleanup)(void* state);
+    void (*preload)(GameScene id);      // Optional: queue assets for background loading
+    void (*suspend)(void* state);       // Optional: called as a transition away starts, before the RSP drain
+    void (*resume)(void* state);        // Optional: called after init, right before the first update
+    bool idle;                          // Scene leaves the CPU free for the preload queue
+    GameScene expected_next;            // Preloaded while this scene is idle (SCENE_COUNT = none)
+} SceneVTable;
+
+// Look up a scene's entry points (NULL for an invalid id)
+const SceneVTable* scene_get_vtable(GameScene id);
+
+// Enter the first scene
+void scene_manager_init(GameScene first, rdpq_font_t* font);
+
+// Run one simulation tick of the active scene and any transition it requests
+// Returns true if the scene changed (the rest of the frame's ticks should be dropped)
+bool scene_manager_update(float dt);
+
+// Once per frame: idle scenes spend leftover time on the preload queue
+void scene_manager_idle(void);
+
+// Render the active scene, interpolated alpha of the way into the next tick
+void scene_manager_render(float alpha);
+
+// Clean up the active scene and free its arena
+void scene_manager_shutdown(void);
+
+GameScene scene_manager_current(void);
+
+#endif // SCENEMANAGER_H
@@ -0,0 +1,41 @@
+/**
+ * @file simclock.c
+ * @brief Fixed-timestep accumulator shared by every scene
+ */
+
+#include "simclock.h"
+
+#define SIM_TICK_US (1000000 / SIM_TICK_HZ)
+
+static uint64_t clock_last_us = 0;
+static uint32_t clock_accum_us = 0;
+
+void sim_clock_init(void) {
+    clock_last_us = get_ticks_us();
+    clock_accum_us = 0;
+}
+
+int sim_clock_advance(void) {
+    uint64_t now_us = get_ticks_us();
+    clock_accum_us += (uint32_t)(now_us - clock_last_us);
+    clock_last_us = now_us;
+    
+    int ticks = clock_accum_us / SIM_TICK_US;
+    if (ticks > SIM_MAX_TICKS_PER_FRAME) {
+        // Too far behind (long stall): run the maximum and drop the rest
+        ticks = SIM_MAX_TICKS_PER_FRAME;
+        clock_accum_us = 0;
+    } else {
+        clock_accum_us -= ticks * SIM_TICK_US;
+    }
+    return ticks;
+}
+
+float sim_clock_alpha(void) {
+    return (float)clock_accum_us / (float)SIM_TICK_US;
+}
+
+void sim_clock_reset(void) {
+    clock_last_us = get_ticks_us();
+    clock_accum_us = 0;
+}
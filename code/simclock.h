@@ -0,0 +1,39 @@
+#ifndef SIMCLOCK_H
+#define SIMCLOCK_H
+
+#include <libdragon.h>
+#include <t3d/t3d.h>
+
+#ifndef SIM_TICK_HZ
+#define SIM_TICK_HZ 60                  // Simulation rate (60 or 30, set from the makefile)
+#endif
+#define SIM_TICK_DT (1.0f / SIM_TICK_HZ)
+#define SIM_MAX_TICKS_PER_FRAME 4       // Beyond this the game slows down instead of spiralling
+
+// Fixed-timestep clock
+// Real time accumulates between frames and is consumed in whole SIM_TICK_DT ticks,
+// so gameplay advances identically whatever the render rate. Whatever is left over
+// becomes the interpolation factor between the last two simulated states.
+
+// Start timing from now
+void sim_clock_init(void);
+
+// Measure the time since the last call and return the number of ticks to simulate
+int sim_clock_advance(void);
+
+// Fraction of a tick left in the accumulator (0-1), for interpolating render state
+float sim_clock_alpha(void);
+
+// Drop accumulated time (after a scene transition, so load time is not simulated)
+void sim_clock_reset(void);
+
+// Linear interpolation between a previous and current position
+static inline T3DVec3 sim_lerp_vec3(const T3DVec3* prev, const T3DVec3* curr, float alpha) {
+    return (T3DVec3){{
+        prev->v[0] + (curr->v[0] - prev->v[0]) * alpha,
+        prev->v[1] + (curr->v[1] - prev->v[1]) * alpha,
+        prev->v[2] + (curr->v[2] - prev->v[2]) * alpha
+    }};
+}
+
+#endif // SIMCLOCK_H
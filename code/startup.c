@@ -1,40 +1,27 @@
 #include "startup.h"
+#include "framepipeline.h"
 #include "scenes.h"
+#include "loadprofiler.h"
 
 void startup_init(SceneStartup* scene, rdpq_font_t* font) {
     scene->scene_time = 0.0f;
-    scene->last_update_time = 0.0f;
     scene->font = font;
     scene->current_logo = 0;
     scene->sound_played = false;
     
     // Load logo sprites
-    scene->libdragon_sprite = sprite_load("rom:/libdragon.sprite");
-    scene->tiny3d_sprite = sprite_load("rom:/tiny3d.sprite");
+    LOAD_PROFILE("sprite", "rom:/libdragon.sprite", scene->libdragon_sprite = sprite_load("rom:/libdragon.sprite"));
+    LOAD_PROFILE("sprite", "rom:/tiny3d.sprite", scene->tiny3d_sprite = sprite_load("rom:/tiny3d.sprite"));
     
     // Load startup sound
-    wav64_open(&scene->startup_sound, "rom:/gamestart.wav64");
+    LOAD_PROFILE("audio", "rom:/gamestart.wav64", wav64_open(&scene->startup_sound, "rom:/gamestart.wav64"));
     
     rdpq_text_register_font(1, scene->font);
 
     debugf("Startup scene initialized\n");
 }
 
-int startup_update(SceneStartup* scene) {
-    // Calculate delta time
-    float current_time = (float)((double)get_ticks_us() / 1000000.0);
-    float delta_time;
-    if (scene->last_update_time == 0.0f) {
-        delta_time = 1.0f / 60.0f;
-    } else {
-        delta_time = current_time - scene->last_update_time;
-    }
-    scene->last_update_time = current_time;
-    
-    if (delta_time < 0.0f || delta_time > 0.5f) {
-        delta_time = 1.0f / 60.0f;
-    }
-
+int startup_update(SceneStartup* scene, float delta_time) {
     // Update scene timer
     scene->scene_time += delta_time;
 
@@ -68,7 +55,7 @@ int startup_update(SceneStartup* scene) {
 }
 
 void startup_render(SceneStartup* scene) {
-    rdpq_attach(display_get(), NULL);
+    rdpq_attach(frame_pipeline_get_display(), NULL);
     
     // Clear screen to black
     rdpq_set_mode_fill(RGBA32(0, 0, 0, 255));
@@ -108,7 +95,7 @@ void startup_render(SceneStartup* scene) {
         rdpq_sprite_blit(current_sprite, x + sprite_width/2, y + sprite_height/2, &params);
     }
 
-    rdpq_detach_show();
+    frame_pipeline_show();
 }
 
 void startup_cleanup(SceneStartup* scene) {
@@ -6,7 +6,6 @@
 
 typedef struct {
     float scene_time;
-    float last_update_time;
     rdpq_font_t* font;
     sprite_t* libdragon_sprite;
     sprite_t* tiny3d_sprite;
@@ -16,7 +15,7 @@ typedef struct {
 } SceneStartup;
 
 void startup_init(SceneStartup* scene, rdpq_font_t* font);
-int startup_update(SceneStartup* scene);
+int startup_update(SceneStartup* scene, float delta_time);
 void startup_render(SceneStartup* scene);
 void startup_cleanup(SceneStartup* scene);
 
@@ -0,0 +1,202 @@
+#!/usr/bin/env python3
+"""
+Bake glTF animation clips into fixed-rate quantized pose tables (.pose)
+
+Usage: bakeposes.py [--rate HZ] [--base-scale S] -o out.pose model.glb [clip ...]
+
+Every clip is sampled at a fixed rate so the runtime can index a frame directly
+instead of decoding keyframes. With no clip names, all clips are baked.
+
+File layout (big-endian):
+    char     magic[4]        "POSE"
+    u16      version         1
+    u16      bone_count
+    u16      clip_count
+    u16      reserved
+    bone_count x char name[32]
+    clip_count x {
+        char name[32]
+        u16  rate            frames per second
+        u16  frame_count
+        u16  flags           1 = scale keys present
+        u16  reserved
+        f32  pos_scale       position units per quantized step
+        u32  data_offset     from the start of the file
+    }
+    per clip: frame_count x bone_count x s16[6] (s16[9] with scale keys)
+        rotation x, y, z (w >= 0 is rebuilt at runtime), scaled by 32767
+        position x, y, z, scaled by pos_scale
+        scale x, y, z, scaled by 4096 (only with scale keys)
+"""
+
+import argparse
+import json
+import math
+import os
+import struct
+import sys
+
+NAME_LEN = 32
+CLIP_HAS_SCALE = 1
+SCALE_ONE = 4096
+COMPONENT_COUNTS = {"SCALAR": 1, "VEC2": 2, "VEC3": 3, "VEC4": 4}
+
+
+def load_gltf(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:4] == b"glTF":
+        json_len = struct.unpack_from("<I", data, 12)[0]
+        doc = json.loads(data[20:20 + json_len])
+        off = 20 + json_len
+        bin_len = struct.unpack_from("<I", data, off)[0]
+        return doc, [data[off + 8:off + 8 + bin_len]]
+    doc = json.loads(data)
+    buffers = []
+    for buf in doc.get("buffers", []):
+        with open(os.path.join(os.path.dirname(path), buf["uri"]), "rb") as f:
+            buffers.append(f.read())
+    return doc, buffers
+
+
+def read_accessor(doc, buffers, index):
+    acc = doc["accessors"][index]
+    view = doc["bufferViews"][acc["bufferView"]]
+    n = COMPONENT_COUNTS[acc["type"]]
+    if acc["componentType"] != 5126:
+        raise ValueError("only float accessors are supported")
+    stride = view.get("byteStride", 4 * n)
+    base = view.get("byteOffset", 0) + acc.get("byteOffset", 0)
+    buf = buffers[view.get("buffer", 0)]
+    return [struct.unpack_from("<%df" % n, buf, base + i * stride) for i in range(acc["count"])]
+
+
+def nlerp(a, b, t):
+    if sum(x * y for x, y in zip(a, b)) < 0.0:
+        b = tuple(-x for x in b)
+    q = tuple(x + (y - x) * t for x, y in zip(a, b))
+    length = math.sqrt(sum(x * x for x in q)) or 1.0
+    return tuple(x / length for x in q)
+
+
+def sample(times, values, interp, t, is_quat):
+    if t <= times[0]:
+        return values[0]
+    if t >= times[-1]:
+        return values[-1]
+    for i in range(len(times) - 1):
+        if times[i] <= t < times[i + 1]:
+            if interp == "STEP":
+                return values[i]
+            f = (t - times[i]) / (times[i + 1] - times[i])
+            if is_quat:
+                return nlerp(values[i], values[i + 1], f)
+            return tuple(x + (y - x) * f for x, y in zip(values[i], values[i + 1]))
+    return values[-1]
+
+
+def pad_name(name):
+    raw = name.encode("ascii")[:NAME_LEN - 1]
+    return raw + b"\0" * (NAME_LEN - len(raw))
+
+
+def bake_clip(doc, buffers, anim, joints, rate, base_scale):
+    tracks = {}
+    duration = 0.0
+    for ch in anim["channels"]:
+        node = ch["target"].get("node")
+        path = ch["target"]["path"]
+        sampler = anim["samplers"][ch["sampler"]]
+        times = [t[0] for t in read_accessor(doc, buffers, sampler["input"])]
+        values = read_accessor(doc, buffers, sampler["output"])
+        tracks[(node, path)] = (times, values, sampler.get("interpolation", "LINEAR"))
+        duration = max(duration, times[-1])
+
+    frame_count = max(1, int(round(duration * rate)))
+    frames = []
+    for i in range(frame_count):
+        t = i / rate
+        bones = []
+        for node in joints:
+            rest = doc["nodes"][node]
+            rot = rest.get("rotation", [0.0, 0.0, 0.0, 1.0])
+            pos = rest.get("translation", [0.0, 0.0, 0.0])
+            scl = rest.get("scale", [1.0, 1.0, 1.0])
+            if (node, "rotation") in tracks:
+                rot = sample(*tracks[(node, "rotation")], t, True)
+            if (node, "translation") in tracks:
+                pos = sample(*tracks[(node, "translation")], t, False)
+            if (node, "scale") in tracks:
+                scl = sample(*tracks[(node, "scale")], t, False)
+            if rot[3] < 0.0:
+                rot = tuple(-x for x in rot)
+            bones.append((rot, tuple(p * base_scale for p in pos), tuple(scl)))
+        frames.append(bones)
+
+    max_pos = max((abs(p) for f in frames for _, pos, _ in f for p in pos), default=0.0)
+    pos_scale = max_pos / 32767.0 if max_pos > 0.0 else 1.0
+    has_scale = any(abs(v - 1.0) > 1e-3 for f in frames for _, _, scl in f for v in scl)
+    flags = CLIP_HAS_SCALE if has_scale else 0
+
+    def q(v, s):
+        return max(-32767, min(32767, int(round(v / s))))
+
+    data = bytearray()
+    for f in frames:
+        for rot, pos, scl in f:
+            data += struct.pack(">6h", q(rot[0], 1.0 / 32767.0), q(rot[1], 1.0 / 32767.0), q(rot[2], 1.0 / 32767.0),
+                                q(pos[0], pos_scale), q(pos[1], pos_scale), q(pos[2], pos_scale))
+            if has_scale:
+                data += struct.pack(">3h", q(scl[0], 1.0 / SCALE_ONE), q(scl[1], 1.0 / SCALE_ONE),
+                                    q(scl[2], 1.0 / SCALE_ONE))
+
+    source_bytes = 0
+    for times, values, _ in tracks.values():
+        source_bytes += 4 * len(times) + 4 * len(values) * len(values[0])
+    return frame_count, flags, pos_scale, bytes(data), source_bytes
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Bake glTF animation clips into .pose tables")
+    parser.add_argument("model")
+    parser.add_argument("clips", nargs="*")
+    parser.add_argument("-o", "--output", required=True)
+    parser.add_argument("--rate", type=int, default=30, help="sample rate in Hz (30 or 60)")
+    parser.add_argument("--base-scale", type=float, default=64.0,
+                        help="position scale, must match the model converter's base scale")
+    args = parser.parse_args()
+
+    doc, buffers = load_gltf(args.model)
+    if not doc.get("skins"):
+        sys.exit("error: %s has no skin" % args.model)
+    joints = doc["skins"][0]["joints"]
+    anims = {a["name"]: a for a in doc.get("animations", [])}
+    names = args.clips or list(anims)
+    for name in names:
+        if name not in anims:
+            sys.exit("error: clip '%s' not found in %s" % (name, args.model))
+
+    header_size = 12 + NAME_LEN * len(joints) + (NAME_LEN + 16) * len(names)
+    out = bytearray(b"POSE" + struct.pack(">HHHH", 1, len(joints), len(names), 0))
+    for node in joints:
+        out += pad_name(doc["nodes"][node].get("name", ""))
+
+    blobs = []
+    offset = header_size
+    for name in names:
+        frame_count, flags, pos_scale, data, source_bytes = bake_clip(doc, buffers, anims[name], joints,
+                                                                      args.rate, args.base_scale)
+        out += pad_name(name) + struct.pack(">HHHHfI", args.rate, frame_count, flags, 0, pos_scale, offset)
+        blobs.append(data)
+        offset += len(data)
+        print("    %-12s %3d frames @ %d Hz: %6d bytes baked, %6d bytes of glTF keys"
+              % (name, frame_count, args.rate, len(data), source_bytes))
+    for data in blobs:
+        out += data
+
+    with open(args.output, "wb") as f:
+        f.write(out)
+
+
+if __name__ == "__main__":
+    main()
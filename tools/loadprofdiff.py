@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+"""
+Compare scene load profiles between two debug logs
+
+Usage: loadprofdiff.py [--scene "INTRO -> LEVEL_1"] [--min-us N] before.log after.log
+
+Reads the "LOADPROF" lines that the load profiler (code/loadprofiler.c) prints
+after every scene transition. For each transition found in both logs, the last
+report of each is compared step by step; steps with the same kind and label are
+summed. Steps are listed by the size of the change, largest first.
+
+Report layout:
+    LOADPROF scene <from> -> <to>: <n> steps (<d> dropped), <wall> ms wall, <top> ms in top-level steps
+    LOADPROF <us> us <bytes> B <depth> <kind> <label>
+"""
+
+import argparse
+import re
+import sys
+
+SCENE_RE = re.compile(r"LOADPROF scene (.+?): (\d+) steps \((\d+) dropped\), ([\d.]+) ms wall")
+STEP_RE = re.compile(r"LOADPROF\s+(\d+) us\s+(\d+) B (\d+) (\S+)\s+(.*)$")
+
+
+def parse_log(path):
+    """Return {transition: {"wall_ms": float, "steps": {(kind, label): [us, bytes]}}}, last report wins"""
+    reports = {}
+    current = None
+    with open(path, "r", errors="replace") as f:
+        for line in f:
+            m = SCENE_RE.search(line)
+            if m:
+                current = {"wall_ms": float(m.group(4)), "dropped": int(m.group(3)), "steps": {}}
+                reports[m.group(1)] = current
+                continue
+            m = STEP_RE.search(line)
+            if m and current is not None:
+                key = (m.group(4), m.group(5).strip())
+                step = current["steps"].setdefault(key, [0, 0])
+                step[0] += int(m.group(1))
+                step[1] += int(m.group(2))
+    return reports
+
+
+def print_diff(name, before, after, min_us):
+    print("%s: %.2f ms -> %.2f ms (%+.2f ms)"
+          % (name, before["wall_ms"], after["wall_ms"], after["wall_ms"] - before["wall_ms"]))
+    if before["dropped"] or after["dropped"]:
+        print("  note: ring overflowed (%d / %d steps dropped), oldest steps are missing"
+              % (before["dropped"], after["dropped"]))
+
+    rows = []
+    for key in set(before["steps"]) | set(after["steps"]):
+        b_us, b_bytes = before["steps"].get(key, [0, 0])
+        a_us, a_bytes = after["steps"].get(key, [0, 0])
+        if abs(a_us - b_us) < min_us:
+            continue
+        rows.append((a_us - b_us, key, b_us, a_us, b_bytes, a_bytes))
+    rows.sort(key=lambda r: abs(r[0]), reverse=True)
+
+    print("  %10s %10s %10s %9s  %-10s %s" % ("before us", "after us", "delta us", "delta B", "kind", "label"))
+    for delta, (kind, label), b_us, a_us, b_bytes, a_bytes in rows:
+        print("  %10d %10d %+10d %+9d  %-10s %s" % (b_us, a_us, delta, a_bytes - b_bytes, kind, label))
+    print()
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Diff LOADPROF reports from two debug logs")
+    parser.add_argument("before")
+    parser.add_argument("after")
+    parser.add_argument("--scene", help="only this transition, e.g. \"INTRO -> LEVEL_1\"")
+    parser.add_argument("--min-us", type=int, default=0, help="hide steps that changed by less than this")
+    args = parser.parse_args()
+
+    before = parse_log(args.before)
+    after = parse_log(args.after)
+    names = [args.scene] if args.scene else [name for name in after if name in before]
+    if not names:
+        sys.exit("error: no transition appears in both logs")
+
+    for name in names:
+        if name not in before or name not in after:
+            sys.exit("error: transition '%s' missing from one of the logs" % name)
+        print_diff(name, before[name], after[name], args.min_us)
+
+
+if __name__ == "__main__":
+    main()
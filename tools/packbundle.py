@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+"""
+Pack converted assets into a single bundle (.bnd) read with one sequential ROM read
+
+Usage: packbundle.py -o out.bnd file [file ...]
+
+Entries are stored by file name (no directory) so "rom:/mecha.t3dm" is found as
+"mecha.t3dm". Every entry starts on a 16-byte boundary, matching the alignment
+the loader asks for, so nothing needs to be shifted after the read.
+
+File layout (big-endian):
+    char     magic[4]        "BNDL"
+    u16      version         1
+    u16      entry_count
+    u32      total_size      whole file, padding included
+    u32      reserved
+    entry_count x {
+        char name[32]        NUL-padded file name
+        u32  offset          from the start of the file
+        u32  size            bytes, padding excluded
+    }
+    entry data, each aligned to 16 bytes
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+NAME_LEN = 32
+ALIGN = 16
+HEADER_SIZE = 16
+ENTRY_SIZE = NAME_LEN + 8
+
+
+def align(value):
+    return (value + ALIGN - 1) & ~(ALIGN - 1)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Pack assets into a .bnd bundle")
+    parser.add_argument("files", nargs="+")
+    parser.add_argument("-o", "--output", required=True)
+    args = parser.parse_args()
+
+    names = [os.path.basename(path) for path in args.files]
+    for name in names:
+        if len(name.encode()) >= NAME_LEN:
+            sys.exit("error: '%s' is longer than %d characters" % (name, NAME_LEN - 1))
+    if len(set(names)) != len(names):
+        sys.exit("error: duplicate file names in bundle")
+
+    blobs = []
+    for path in args.files:
+        with open(path, "rb") as f:
+            blobs.append(f.read())
+
+    offset = align(HEADER_SIZE + ENTRY_SIZE * len(names))
+    entries = bytearray()
+    for name, data in zip(names, blobs):
+        entries += name.encode().ljust(NAME_LEN, b"\0") + struct.pack(">II", offset, len(data))
+        offset = align(offset + len(data))
+    total_size = offset
+
+    out = bytearray(b"BNDL" + struct.pack(">HHII", 1, len(names), total_size, 0))
+    out += entries
+    for data in blobs:
+        out += b"\0" * (align(len(out)) - len(out))
+        out += data
+    out += b"\0" * (total_size - len(out))
+
+    with open(args.output, "wb") as f:
+        f.write(out)
+    print("    %d entries, %d bytes" % (len(names), total_size))
+
+
+if __name__ == "__main__":
+    main()